@@ -184,10 +184,12 @@ int main() {
   ccplx.dump_cplx(5);
 
   //--------------------------------------------------------------------------------------------------------------------------------------------------------------
-  // Fold the triangles on our clipping plane
+  // Fold the triangles on our clipping plane.  Brent's method needs far fewer evaluations of cpf than the default (bisection).
+  ccplx.set_edge_solver(cc_t::edge_solver_t::BRENT);
   ccplx.triangle_folder([](cc_t::node_data_t x){return tc_t::tsampf_to_cdatf(        cpf, x); }, 
                         [](cc_t::node_data_t x){return tc_t::tsampf_to_clcdf(4, 3.5, cpf, x); });
   std::cout << "POST FOLD" << std::endl;
+  std::cout << "FOLD Edges: " << ccplx.edge_solver_sdf_solve_count() << "  SDF Evaluations: " << ccplx.edge_solver_sdf_eval_count() << std::endl;
   ccplx.dump_cplx(5);
 
   //--------------------------------------------------------------------------------------------------------------------------------------------------------------
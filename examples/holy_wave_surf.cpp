@@ -71,6 +71,8 @@ int main() {
 
   std::cout << "SAMPLE: START" << std::endl;  
   std::chrono::time_point<std::chrono::system_clock> sample_start_time = std::chrono::system_clock::now();
+  std::vector<mjr::MRccT5::node_data_t> tri_nodes;
+  tri_nodes.reserve(3*num_tri);
   for(int i=0; i<num_tri; i++) {
     double xc = x_uniform_dist_float(rEng);
     double yc = y_uniform_dist_float(rEng);
@@ -92,13 +94,15 @@ int main() {
     double xy_mag  = std::sqrt(xa*xa+ya*ya);
     double xyz_mag = std::sqrt(xa*xa+ya*ya+za*za);
     
-    mjr::MRccT5::node_idx_t p1i = aPoly.add_node({x1, y1, z1, za, xy_mag, xyz_mag});
-    mjr::MRccT5::node_idx_t p2i = aPoly.add_node({x2, y2, z2, za, xy_mag, xyz_mag});
-    mjr::MRccT5::node_idx_t p3i = aPoly.add_node({x3, y3, z3, za, xy_mag, xyz_mag});
-
-    aPoly.add_cell(mjr::MRccT5::cell_kind_t::TRIANGLE, {p1i, p2i, p3i});
+    tri_nodes.push_back({x1, y1, z1, za, xy_mag, xyz_mag});
+    tri_nodes.push_back({x2, y2, z2, za, xy_mag, xyz_mag});
+    tri_nodes.push_back({x3, y3, z3, za, xy_mag, xyz_mag});
   }
 
+  // Node i*3+j is vertex j of triangle i, so the node index list is also the triangle vertex list.
+  mjr::MRccT5::node_idx_list_t tri_verts = aPoly.add_nodes(tri_nodes);
+  aPoly.add_cells(mjr::MRccT5::cell_kind_t::TRIANGLE, tri_verts);
+
   std::cout << "SAMPLE: Total Points: " << aPoly.node_count() << std::endl;
   std::cout << "SAMPLE: Total Cells: " << aPoly.num_cells() << std::endl;
 
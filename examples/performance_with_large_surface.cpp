@@ -36,6 +36,7 @@
      - Try reducing the number of data variables stored in the cell complex
      - Try removing the normal vector from the output
      - Try both MRccT5 & MRccF5 for cc_t
+     - Try different thread counts for construct_geometry_fans() (the last argument)
    - How to include a synthetic value that can be used for color mapping --  @f$ c(u,v) @f$ can be used to render stripes on the surface.
    - How to compute a normal to a parametric surface.  If the surface is defined by 
      @f[ \vec{f}(u,v)=(x(u,v), y(u,v), z(u,v)) @f]
@@ -100,7 +101,9 @@ int main() {
                                 2,
                                 {{tc_t::val_src_spc_t::FRANGE,  0},
                                  {tc_t::val_src_spc_t::FRANGE,  1},
-                                 {tc_t::val_src_spc_t::FRANGE,  2}});
+                                 {tc_t::val_src_spc_t::FRANGE,  2}},
+                                nullptr,
+                                0);     // Bridge on all cores.  Use 1 for a single thread.
   std::chrono::time_point<std::chrono::system_clock> fan_time = std::chrono::system_clock::now();
 
   ccplx.create_named_datasets({"u", "v", 
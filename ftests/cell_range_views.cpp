@@ -0,0 +1,115 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      cell_range_views.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+/** @cond exj */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "MR_rect_tree.hpp"
+#include "MR_cell_cplx.hpp"
+#include "MR_rt_to_cc.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <ranges>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef mjr::tree15b2d1rT            tt_t;
+typedef mjr::MRccT5                  cc_t;
+typedef mjr::MR_rt_to_cc<tt_t, cc_t> tc_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+tt_t::rrpt_t half_sphere(tt_t::drpt_t xvec) {
+  double m = xvec[0] * xvec[0] + xvec[1] * xvec[1];
+  if (m > 1) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return std::sqrt(1-m);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool same_cplx(const cc_t& a, const cc_t& b) {
+  if ((a.node_count() != b.node_count()) || (a.num_cells() != b.num_cells()))
+    return false;
+  for(cc_t::node_idx_t i=0; i<a.node_count(); ++i)
+    if ( !(std::ranges::equal(a.get_node_data(i), b.get_node_data(i))))
+      return false;
+  for(int i=0; i<a.num_cells(); ++i)
+    if ((a.get_cell_kind(i) != b.get_cell_kind(i)) || !(std::ranges::equal(a.get_cell_verts(i), b.get_cell_verts(i))))
+      return false;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main() {
+  tt_t tree({-0.9, -0.9}, 
+            { 0.9,  0.9});
+  cc_t ccplx;
+
+  // Sample a uniform grid across the domain
+  tree.refine_grid(3, half_sphere);
+
+  tc_t::val_src_lst_t point_src = {{tc_t::val_src_spc_t::FDOMAIN, 0}, 
+                                   {tc_t::val_src_spc_t::FDOMAIN, 1},
+                                   {tc_t::val_src_spc_t::FRANGE,  0}};
+
+  /* The reference type of a transform view is tt_t::diti_t (a prvalue) -- like a std::generator<tt_t::diti_t>.  Geometry constructed from such a range
+     must match geometry constructed from the leaf cell list. */
+  auto leaf_view = [&tree]() { return tree.get_leaf_cells() | std::views::transform([](tt_t::diti_t cell) { return cell; }); };
+
+  bool all_same = true;
+  for(auto [output_centers, output_corners] : {std::pair(true, true), std::pair(true, false), std::pair(false, true)}) {
+    cc_t list_ccplx, view_ccplx;
+    tc_t::construct_geometry_points(list_ccplx, tree,              point_src, output_centers, output_corners);
+    tc_t::construct_geometry_points(view_ccplx, tree, leaf_view(), point_src, output_centers, output_corners);
+    all_same = all_same && same_cplx(list_ccplx, view_ccplx);
+  }
+  for(int output_dimension=0; output_dimension<3; ++output_dimension) {
+    cc_t list_ccplx, view_ccplx;
+    tc_t::construct_geometry_fans(list_ccplx, tree,              output_dimension, point_src, half_sphere);
+    tc_t::construct_geometry_fans(view_ccplx, tree, leaf_view(), output_dimension, point_src, half_sphere);
+    all_same = all_same && same_cplx(list_ccplx, view_ccplx);
+  }
+  cc_t list_ccplx;
+  tc_t::construct_geometry_rects(list_ccplx, tree,              2, point_src);
+  tc_t::construct_geometry_rects(ccplx,      tree, leaf_view(), 2, point_src);
+  all_same = all_same && same_cplx(list_ccplx, ccplx);
+
+  // Same output as rect_fix_nan when all is well.  Otherwise no output, so the test fails.
+  if (all_same) {
+    ccplx.create_named_datasets({"x", "y", "f(x,y)"},
+                                {{"NORMALS", {0, 1, 2}}});
+    ccplx.write_xml_vtk("cell_range_views.vtu", "cell_range_views");
+  } else {
+    std::cout << "ERROR: Geometry from a view differs from geometry from the leaf cell list!" << std::endl;
+    std::remove("cell_range_views.vtu");
+  }
+}
+/** @endcond */
@@ -0,0 +1,151 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      stream_geometry.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+/** @cond exj */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "MR_rect_tree.hpp"
+#include "MR_cell_cplx.hpp"
+#include "MR_rt_to_cc.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef mjr::tree15b2d1rT            tt_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+tt_t::rrpt_t half_sphere(tt_t::drpt_t xvec) {
+  double m = xvec[0] * xvec[0] + xvec[1] * xvec[1];
+  if (m > 1) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return std::sqrt(1-m);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* A saddle that is NaN in the second & fourth quadrants */
+tt_t::rrpt_t half_saddle(tt_t::drpt_t xvec) {
+  double m = xvec[0] * xvec[1];
+  if (m < 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return m;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string slurp(std::string file_name) {
+  std::ifstream in_stream(file_name, std::ios::in | std::ios::binary);
+  std::stringstream ss;
+  ss << in_stream.rdbuf();
+  std::remove(file_name.c_str());
+  return ss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* True if a complex, and geometry streamed by stream_func, produce the same non-empty file.  The stream writer never writes cells with a NaN point (a
+   negative vertex), so they are culled from the complex first -- they only exist when cc_t doesn't check vertexes. */
+template<typename cc_t, typename stream_func_t>
+bool same_file(cc_t& ccplx, typename cc_t::stream_format_t format, stream_func_t stream_func) {
+  ccplx.cull_cells([](const typename cc_t::cell_verts_t& verts) { return std::any_of(verts.begin(), verts.end(), [](auto v) { return v < 0; }); });
+  ccplx.create_named_datasets({"x", "y", "f(x,y)"}, {{"NORMALS", {0, 1, 2}}});
+  std::string ext = (format == cc_t::stream_format_t::PLY ? ".ply" : ".vtu");
+  if (format == cc_t::stream_format_t::PLY)
+    ccplx.write_ply("stream_geometry_a" + ext, "stream_geometry");
+  else
+    ccplx.write_xml_vtk("stream_geometry_a" + ext, "stream_geometry");
+  typename cc_t::stream_writer_t writer;
+  writer.open("stream_geometry_b" + ext, "stream_geometry", format, ccplx.get_data_name_to_data_idx_lst());
+  stream_func(writer);
+  writer.close();
+  std::string a_text = slurp("stream_geometry_a" + ext);
+  std::string b_text = slurp("stream_geometry_b" + ext);
+  return ( !(a_text.empty()) && (a_text == b_text));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* Streamed geometry must produce the same file as geometry constructed in a MR_cell_cplx & then written.  PLY files only hold 2D cells.  One result is
+   appended for each comparison. */
+template<typename cc_t>
+void check_streams(std::vector<bool>& results, const tt_t& tree, tt_t::drpt2rrpt_func_t func) {
+  typedef mjr::MR_rt_to_cc<tt_t, cc_t> tc_t;
+  typename tc_t::val_src_lst_t point_src = {{tc_t::val_src_spc_t::FDOMAIN, 0}, 
+                                            {tc_t::val_src_spc_t::FDOMAIN, 1},
+                                            {tc_t::val_src_spc_t::FRANGE,  0}};
+  for(int num_threads: {1, 4}) {
+    for(int output_dimension=0; output_dimension<3; ++output_dimension) {
+      for(auto format: {cc_t::stream_format_t::XML_VTK, cc_t::stream_format_t::PLY}) {
+        if ((format == cc_t::stream_format_t::PLY) && (output_dimension < 2))
+          continue;
+        cc_t fans_ccplx, rects_ccplx;
+        tc_t::construct_geometry_fans(fans_ccplx, tree, output_dimension, point_src, func, num_threads);
+        results.push_back(same_file(fans_ccplx, format, [&](typename cc_t::stream_writer_t& writer) {
+          tc_t::stream_geometry_fans(writer, tree, output_dimension, point_src, func, num_threads);
+        }));
+        tc_t::construct_geometry_rects(rects_ccplx, tree, output_dimension, point_src, true, num_threads);
+        results.push_back(same_file(rects_ccplx, format, [&](typename cc_t::stream_writer_t& writer) {
+          tc_t::stream_geometry_rects(writer, tree, output_dimension, point_src, true, num_threads);
+        }));
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main() {
+  std::vector<bool> results;
+
+  for(auto func: {half_sphere, half_saddle}) {
+    tt_t tree({-0.9, -0.9}, 
+              { 0.9,  0.9});
+
+    // Sample a uniform grid across the domain
+    tree.refine_grid(3, func);
+
+    check_streams<mjr::MRccT5>(results, tree, func);
+    check_streams<mjr::MRccF5>(results, tree, func);
+  }
+
+  // Output one vertex per comparison: x is the comparison number, and y is 1 if it passed.  As with thread_count, this doesn't depend on the tree.
+  mjr::MRccT5 ccplx;
+  for(std::size_t i=0; i<results.size(); ++i) {
+    if ( !(results[i]))
+      std::cout << "ERROR: Streamed geometry differs from geometry constructed in a MR_cell_cplx! (comparison " << i << ")" << std::endl;
+    ccplx.add_cell(mjr::MRccT5::cell_kind_t::POINT, {ccplx.add_node({static_cast<double>(i), (results[i] ? 1.0 : 0.0), 0.0})});
+  }
+  ccplx.create_named_datasets({"comparison", "passed"});
+  ccplx.write_xml_vtk("stream_geometry.vtu", "stream_geometry");
+}
+/** @endcond */
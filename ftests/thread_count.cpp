@@ -0,0 +1,143 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      thread_count.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+/** @cond exj */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "MR_rect_tree.hpp"
+#include "MR_cell_cplx.hpp"
+#include "MR_rt_to_cc.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef mjr::tree15b2d1rT            tt_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+tt_t::rrpt_t half_sphere(tt_t::drpt_t xvec) {
+  double m = xvec[0] * xvec[0] + xvec[1] * xvec[1];
+  if (m > 1) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return std::sqrt(1-m);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* A saddle that is NaN in the second & fourth quadrants */
+tt_t::rrpt_t half_saddle(tt_t::drpt_t xvec) {
+  double m = xvec[0] * xvec[1];
+  if (m < 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return m;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string slurp(std::string file_name) {
+  std::ifstream in_stream(file_name, std::ios::in | std::ios::binary);
+  std::stringstream ss;
+  ss << in_stream.rdbuf();
+  std::remove(file_name.c_str());
+  return ss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* True if both complexes produce the same, non-empty, XML VTK file. */
+template<typename cc_t>
+bool same_vtu(cc_t& a, cc_t& b) {
+  a.create_named_datasets({"x", "y", "f(x,y)"}, {{"NORMALS", {0, 1, 2}}});
+  b.create_named_datasets({"x", "y", "f(x,y)"}, {{"NORMALS", {0, 1, 2}}});
+  a.write_xml_vtk("thread_count_a.vtu", "thread_count");
+  b.write_xml_vtk("thread_count_b.vtu", "thread_count");
+  std::string a_text = slurp("thread_count_a.vtu");
+  std::string b_text = slurp("thread_count_b.vtu");
+  return ( !(a_text.empty()) && (a_text == b_text));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* Geometry is constructed in chunks on each thread, and merged in chunk order.  Broken edges are healed in each chunk, so the same healed edge may be
+   found by several threads.  When cc_t doesn't check vertexes, NaN corners are kept as negative vertexes.  In every case the output must not depend on
+   the number of threads.  One result is appended for each comparison. */
+template<typename cc_t>
+void check_thread_counts(std::vector<bool>& results, const tt_t& tree, tt_t::drpt2rrpt_func_t func) {
+  typedef mjr::MR_rt_to_cc<tt_t, cc_t> tc_t;
+  typename tc_t::val_src_lst_t point_src = {{tc_t::val_src_spc_t::FDOMAIN, 0}, 
+                                            {tc_t::val_src_spc_t::FDOMAIN, 1},
+                                            {tc_t::val_src_spc_t::FRANGE,  0}};
+  for(int num_threads: {3, 4}) {
+    for(int output_dimension=0; output_dimension<3; ++output_dimension) {
+      cc_t healed_one_ccplx, healed_many_ccplx;
+      tc_t::construct_geometry_fans(healed_one_ccplx,  tree, output_dimension, point_src, func, 1);
+      tc_t::construct_geometry_fans(healed_many_ccplx, tree, output_dimension, point_src, func, num_threads);
+      results.push_back(same_vtu(healed_one_ccplx, healed_many_ccplx));
+      cc_t fans_one_ccplx, fans_many_ccplx;
+      tc_t::construct_geometry_fans(fans_one_ccplx,  tree, output_dimension, point_src, nullptr, 1);
+      tc_t::construct_geometry_fans(fans_many_ccplx, tree, output_dimension, point_src, nullptr, num_threads);
+      results.push_back(same_vtu(fans_one_ccplx, fans_many_ccplx));
+      cc_t rects_one_ccplx, rects_many_ccplx;
+      tc_t::construct_geometry_rects(rects_one_ccplx,  tree, output_dimension, point_src, true, 1);
+      tc_t::construct_geometry_rects(rects_many_ccplx, tree, output_dimension, point_src, true, num_threads);
+      results.push_back(same_vtu(rects_one_ccplx, rects_many_ccplx));
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main() {
+  std::vector<bool> results;
+
+  for(auto func: {half_sphere, half_saddle}) {
+    tt_t tree({-0.9, -0.9}, 
+              { 0.9,  0.9});
+
+    // Sample a uniform grid across the domain
+    tree.refine_grid(3, func);
+
+    check_thread_counts<mjr::MRccT5>(results, tree, func);
+    check_thread_counts<mjr::MRccF5>(results, tree, func);
+  }
+
+  /* Output one vertex per comparison: x is the comparison number, and y is 1 if it passed.  Unlike geometry, this doesn't depend on how the tree was
+     sampled -- so each comparison may use a different function & complex type without a golden file for each. */
+  mjr::MRccT5 ccplx;
+  for(std::size_t i=0; i<results.size(); ++i) {
+    if ( !(results[i]))
+      std::cout << "ERROR: Geometry constructed with several threads differs from geometry constructed with 1 thread! (comparison " << i << ")" << std::endl;
+    ccplx.add_cell(mjr::MRccT5::cell_kind_t::POINT, {ccplx.add_node({static_cast<double>(i), (results[i] ? 1.0 : 0.0), 0.0})});
+  }
+  ccplx.create_named_datasets({"comparison", "passed"});
+  ccplx.write_xml_vtk("thread_count.vtu", "thread_count");
+}
+/** @endcond */
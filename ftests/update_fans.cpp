@@ -0,0 +1,152 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      update_fans.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @brief     Create a simple tree we can yse fir testing.@EOL
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+/** @cond exj */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "MR_rect_tree.hpp"
+#include "MR_cell_cplx.hpp"
+#include "MR_rt_to_cc.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <set>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef mjr::tree15b2d1rT            tt_t;
+typedef mjr::MRccT5                  cc_t;
+typedef mjr::MR_rt_to_cc<tt_t, cc_t> tc_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+tt_t::rrpt_t zero(tt_t::drpt_t xvec) {
+  return 0*xvec[0];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+tt_t::rrpt_t f(tt_t::drpt_t xvec) {
+  if (xvec[0]*(-2.9)+1.6<xvec[1]) {
+    return std::numeric_limits<double>::quiet_NaN();
+  } else {
+    return 0.0;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* Cells of a complex as a set -- each cell is its kind & the sorted data of its vertexes.  Independent of cell order, vertex order, & node indexes. */
+typedef std::set<std::pair<cc_t::cell_kind_t, std::vector<cc_t::node_data_t>>> cell_set_t;
+
+cell_set_t cell_set(const cc_t& ccplx) {
+  cell_set_t cells;
+  for(int cell_idx=0; cell_idx<ccplx.num_cells(); ++cell_idx) {
+    std::vector<cc_t::node_data_t> verts;
+    for(auto vert: ccplx.get_cell_verts(cell_idx)) {
+      auto node_data = ccplx.get_node_data(vert);
+      verts.emplace_back(node_data.begin(), node_data.end());
+    }
+    std::sort(verts.begin(), verts.end());
+    cells.insert({ccplx.get_cell_kind(cell_idx), verts});
+  }
+  return cells;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main() {
+  tc_t::val_src_lst_t point_src = {{tc_t::val_src_spc_t::FDOMAIN, 0}, 
+                                   {tc_t::val_src_spc_t::FDOMAIN, 1},
+                                   {tc_t::val_src_spc_t::FRANGE,  0}};
+
+  // One incrementally updated complex for each output_dimension.  Lower dimensions rebuild neighbors of neighbors.
+  std::array<cc_t, 3>                  upd_ccplx;
+  std::array<tc_t::bridge_state_t, 3>  upd_state;
+  std::array<cc_t, 3>                  nan_upd_ccplx;
+  std::array<tc_t::bridge_state_t, 3>  nan_upd_state;
+
+  // Same refinement as flat_test_tree_01, with an update after each step
+  tt_t tree;
+  auto update = [&]() {
+    for(int output_dimension=0; output_dimension<3; ++output_dimension)
+      tc_t::update_geometry_fans(upd_ccplx[output_dimension], upd_state[output_dimension], tree, output_dimension, point_src);
+  };
+
+  tree.refine_grid(1, zero);
+  update();
+
+  auto c1 = tree.ccc_get_children(tree.ccc_get_top_cell(), 0, -1);
+  tree.refine_once(c1[0], zero);
+  update();
+
+  auto c2 = tree.ccc_get_children(c1[0], 0, -1);
+  tree.refine_recursive(c2[0], 4, zero);
+  update();
+
+  tree.balance_tree(1, zero);
+  update();
+
+  // Same function as nan_solver, so broken edges are healed
+  tt_t nan_tree;
+  auto nan_update = [&]() {
+    for(int output_dimension=0; output_dimension<3; ++output_dimension)
+      tc_t::update_geometry_fans(nan_upd_ccplx[output_dimension], nan_upd_state[output_dimension], nan_tree, output_dimension, point_src, f);
+  };
+
+  nan_tree.refine_grid(1, f);
+  nan_update();
+
+  auto n1 = nan_tree.ccc_get_children(nan_tree.ccc_get_top_cell(), 0, -1);
+  nan_tree.refine_recursive(n1[0], 2, f);
+  nan_update();
+
+  nan_tree.balance_tree(1, f);
+  nan_update();
+
+  // Updated complexes must have the same cells as complexes constructed from scratch
+  bool all_same = true;
+  cc_t ccplx;
+  for(int output_dimension=0; output_dimension<3; ++output_dimension) {
+    cc_t new_ccplx, nan_new_ccplx;
+    tc_t::construct_geometry_fans(new_ccplx,     tree,     output_dimension, point_src);
+    tc_t::construct_geometry_fans(nan_new_ccplx, nan_tree, output_dimension, point_src, f);
+    all_same = all_same && (cell_set(new_ccplx)     == cell_set(upd_ccplx[output_dimension]));
+    all_same = all_same && (cell_set(nan_new_ccplx) == cell_set(nan_upd_ccplx[output_dimension]));
+    if (output_dimension == 2)
+      ccplx = new_ccplx;
+  }
+
+  // Same output as flat_test_tree_01 when all is well.  Otherwise no output, so the test fails.
+  if (all_same) {
+    ccplx.create_named_datasets({"x", "y", "f(x,y)"});
+    ccplx.write_xml_vtk("update_fans.vtu", "update_fans");
+  } else {
+    std::cout << "ERROR: Updated geometry differs from geometry constructed from scratch!" << std::endl;
+    std::remove("update_fans.vtu");
+  }
+}
+/** @endcond */
@@ -1,5 +1,5 @@
-#ifndef CONFIG_H
-#define CONFIG_H
+#ifndef FUNCVIZ_CONFIG_HPP
+#define FUNCVIZ_CONFIG_HPP
 
 #define FUNCVIZ_PROJECT_NAME  "@CMAKE_PROJECT_NAME@"
 
@@ -21,20 +21,23 @@
 #define FUNCVIZ_FOUND_DOXYGEN @FUNCVIZ_FOUND_DOXYGEN@
 #define FUNCVIZ_FOUND_BTEST   @FUNCVIZ_FOUND_BTEST@
 #define FUNCVIZ_FOUND_MRASTER @FUNCVIZ_FOUND_MRASTER@
+#define FUNCVIZ_FOUND_ZLIB    @FUNCVIZ_FOUND_ZLIB@
 
 #define FUNCVIZ_OPT_DOXYGEN   @FUNCVIZ_OPT_DOXYGEN@
 #define FUNCVIZ_OPT_BTEST     @FUNCVIZ_OPT_BTEST@
 #define FUNCVIZ_OPT_MRASTER   @FUNCVIZ_OPT_MRASTER@
+#define FUNCVIZ_OPT_ZLIB      @FUNCVIZ_OPT_ZLIB@
 
 #include <string>
 
-std::string funcviz_version_string() { return std::string(FUNCVIZ_VERSION_TAG) + " -- " + std::string(FUNCVIZ_VERSION_DATE); }
+inline std::string funcviz_version_string() { return std::string(FUNCVIZ_VERSION_TAG) + " -- " + std::string(FUNCVIZ_VERSION_DATE); }
 
-int funcviz_version_major() { return FUNCVIZ_VERSION_MAJOR; }
-int funcviz_version_minor() { return FUNCVIZ_VERSION_MINOR; }
-int funcviz_version_patch() { return FUNCVIZ_VERSION_PATCH; }
-int funcviz_version_tweak() { return FUNCVIZ_VERSION_TWEAK; }
+inline int funcviz_version_major() { return FUNCVIZ_VERSION_MAJOR; }
+inline int funcviz_version_minor() { return FUNCVIZ_VERSION_MINOR; }
+inline int funcviz_version_patch() { return FUNCVIZ_VERSION_PATCH; }
+inline int funcviz_version_tweak() { return FUNCVIZ_VERSION_TWEAK; }
 
-bool funcviz_support_mraster() { return FUNCVIZ_OPT_MRASTER; }
+inline bool funcviz_support_mraster() { return FUNCVIZ_OPT_MRASTER; }
+inline bool funcviz_support_zlib()    { return FUNCVIZ_FOUND_ZLIB;  }
 
 #endif
@@ -38,25 +38,52 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #include <algorithm>                                                     /* STL algorithm           C++11    */
 #include <array>                                                         /* array template          C++11    */
+#include <bit>                                                           /* STL bit manipulation    C++20    */
+#include <charconv>                                                      /* C++ number conversion   C++17    */
 #include <cmath>                                                         /* std:: C math.h          C++11    */
+#include <cstdint>                                                       /* std:: C stdint.h        C++11    */
+#include <cstdio>                                                        /* std:: C stdio.h         C++11    */
+#include <cstring>                                                       /* std:: C string.h        C++11    */
 #include <fstream>                                                       /* C++ fstream             C++98    */
 #include <functional>                                                    /* STL funcs               C++98    */
+#include <initializer_list>                                              /* STL initializer_list    C++11    */
 #include <iomanip>                                                       /* C++ stream formatting   C++11    */
 #include <iostream>                                                      /* C++ iostream            C++11    */
+#include <limits>                                                        /* C++ Numeric limits      C++11    */
 #include <map>                                                           /* STL map                 C++11    */
-#include <set>                                                           /* STL set                 C++98    */
+#include <span>                                                          /* STL span                C++20    */
 #include <sstream>                                                       /* C++ string stream       C++      */
 #include <string>                                                        /* C++ strings             C++11    */
+#include <thread>                                                        /* C++ threads             C++11    */
+#include <type_traits>                                                   /* C++ metaprogramming     C++11    */
 #include <unordered_map>                                                 /* STL hash map            C++11    */
+#include <utility>                                                       /* STL utility             C++11    */
 #include <variant>                                                       /* C++ variant type        C++17    */
 #include <vector>                                                        /* STL vector              C++11    */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #include "MR_math.hpp"                                                   /* My Simple Math Utilities          */
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if __has_include("funcviz_config.hpp")
+#include "funcviz_config.hpp"                                            /* FuncViz build configuration       */
+#endif
+
+#if FUNCVIZ_FOUND_ZLIB
+#include <zlib.h>                                                        /* zlib compression                 */
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Put everything in the mjr namespace
 namespace mjr {
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  /** Storage layouts for MR_cell_cplx node data (See: MR_cell_cplx node_store template parameter). */
+  enum class MR_cc_node_store_t { VECTORS,   //!< One std::vector per node.  Nodes may have different lengths.
+                                  FLAT,      //!< One contiguous buffer with a fixed stride.  All nodes must have the same length.
+                                  COLUMNS,   //!< One std::vector per node data component.  All nodes must have the same length.
+                                };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   /** @brief Template class used to store and transform cell complexes (mesh/triangluation/etc...) and data sets generated from  MR_rect_tree sample data.
 
       The primary use case is to store and manipulate geometric (i.e. mesh) data derived from MR_rect_tree objects.  On the mesh manipulation front the focus
@@ -70,8 +97,10 @@ namespace mjr {
           - Only four types of cells are supported: points, segments, triangles, quads, pyramids, & hexahedrons.
           - No tetrahedrons!  This may seem bazaar; however, they are simply not a natural product of MR_rect_tree tessellation.
           - Unlike MR_rect_tree, this class can't operate on data of dimension higher than 3!
+          - Cells are stored in compressed row form: one vertex array, an offset array, & a cell kind array (See: get_cell_verts() & get_cell_kind())
         - Data
           - Only point data is supported (i.e. no cell data)
+          - Node data may be stored as one vector per node, one flat fixed-stride buffer, or one vector per component (See: MR_cc_node_store_t)
           - Data elements are scalar and/or vector.  No tensors, fields, etc...
           - uft_t types are used for atomic data components (scalars are uft_t, and components of vectors are uft_t).
         - Computations/Manipulation
@@ -81,9 +110,14 @@ namespace mjr {
           - Write only.
           - VTK files
             - Only Unstructured_Grid files are supported
-            - Both legacy & XML files are supported, but they are ASCII only.
+            - Both legacy & XML files are supported
+            - Legacy files may be ASCII or big endian binary (See: legacy_encoding_t)
+            - XML files may be ASCII, inline base64 binary, or raw appended binary -- binary data may be zlib compressed (See: xml_encoding_t)
             - XML files are serial and self contained
-            - Note that NaN's in ASCII legacy files are not properly handled by many VTK applications
+            - Note that NaN's in ASCII legacy files are not properly handled by many VTK applications -- binary legacy files keep them intact
+          - PLY files
+            - Only triangle & quad cells are supported
+            - Files may be ASCII or binary with float or double vertex properties (See: ply_encoding_t)
         - Error Checking
           - It's pretty limited
           - Memory allocation -- you run out, the thing crashes
@@ -139,8 +173,9 @@ namespace mjr {
                                                                                                           2 ----------------- 3  Front
          \endverbatim
 
-      A number of quality checks may be performed on points and cells before they are added to the object.  These checks can slow down execution of add_cell()
-      by an order of magnitude, and almost double the RAM required for this class.  These checks are entirely optional.
+      A number of quality checks may be performed on points and cells before they are added to the object.  These checks slow down execution of add_node() &
+      add_cell(), and the uniqueness checks increase the RAM required for this class.  The cell checks use constexpr topology tables and fixed size arrays, so
+      they don't allocate memory.  These checks are entirely optional.
 
         - chk_point_unique:
           - Many 3D file formats store the master list of potential points, and then use an integer index into this list when defining geometric objects.
@@ -196,14 +231,17 @@ namespace mjr {
         @tparam chk_cell_dimension Do cell dimension checks (See: cell_stat_t)
         @tparam chk_cell_edges     Do cell edge checks (See: cell_stat_t)
         @tparam flt_type           Type for floating point values (
-        @tparam eps                Epsilon used to detect zero */
-  template <bool     chk_point_unique,
-            bool     chk_cell_unique,
-            bool     chk_cell_vertexes,
-            bool     chk_cell_dimension,
-            bool     chk_cell_edges,
-            typename flt_type,
-            flt_type eps
+        @tparam eps                Epsilon used to detect zero
+        @tparam node_store         Node data storage layout.  The FLAT & COLUMNS layouts avoid a heap allocation per node, but require every node to
+                                   have the same number of data values -- the length of the first node added fixes the width for the object. */
+  template <bool               chk_point_unique,
+            bool               chk_cell_unique,
+            bool               chk_cell_vertexes,
+            bool               chk_cell_dimension,
+            bool               chk_cell_edges,
+            typename           flt_type,
+            flt_type           eps,
+            MR_cc_node_store_t node_store = MR_cc_node_store_t::VECTORS
             // double eps
             >
   requires ((std::is_floating_point<flt_type>::value) &&
@@ -295,19 +333,30 @@ namespace mjr {
                                CONCAVE,        //!< (QUAD, HEXAHEDRON, or PYRAMID) was concave                   TBD
                              };
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Cell Types. */
-      enum class cell_kind_t { POINT,
-                               SEGMENT,
-                               TRIANGLE,
-                               QUAD,
-                               // TETRAHEDRON
-                               HEXAHEDRON,
-                               PYRAMID,
-                             };
+      /** Cell Types.
+          The values are the VTK cell type integers, so the cell kind array may be written directly to VTK files (See: cell_kind_to_vtk_type()). */
+      enum class cell_kind_t : std::uint8_t { POINT      =  1,
+                                              SEGMENT    =  3,
+                                              TRIANGLE   =  5,
+                                              QUAD       =  9,
+                                              // TETRAHEDRON = 10
+                                              HEXAHEDRON = 12,
+                                              PYRAMID    = 14,
+                                            };
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Type to hold the vertexes of a poly cell */
       typedef node_idx_list_t cell_verts_t;
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Type for a read only view of the vertexes of a cell stored in the complex.  Invalidated when cells are added or removed. */
+      typedef std::span<const node_idx_t> cell_verts_span_t;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Root finders available to edge_solver_sdf().  All of them keep a bracket, so the result is always between the edge vertexes. */
+      enum class edge_solver_t { BISECTION, //!< Bisection.  About log2(1/solve_epsilon) evaluations per edge.
+                                 ILLINOIS,  //!< Regula falsi with the Illinois modification.
+                                 BRENT,     //!< Brent's method -- inverse quadratic interpolation, secant, & bisection.
+                                 ITP,       //!< Interpolate, Truncate, & Project.  Never much worse than bisection.
+                               };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Type to hold a poly cell -- a list of point indexes */
       // struct cell_t { 
       //     cell_kind_t  type;
@@ -327,32 +376,198 @@ namespace mjr {
       /** True if the last point given to the add_node() method was new -- i.e. not on the central node data.
           Only updated if chk_point_unique is true.  See: last_point_added_was_new() */
       bool last_point_new = true;
-      /** @cond */  // Leaving this out of doxygen because I don't like how it shows up...
-      //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Less operator for pnt_lst_uniq_t.
-          @return If a & b are close in space, then return false.  Otherwise uses lexicographic ordering. */
-      struct pnt_less {
-          bool operator()(const fvec3_t& a, const fvec3_t& b) const { return (((std::abs(a[0]-b[0]) > eps) ||
-                                                                               (std::abs(a[1]-b[1]) > eps) ||
-                                                                               (std::abs(a[2]-b[2]) > eps)) &&
-                                                                              ((a[0] < b[0]) ||
-                                                                               ((a[0] == b[0]) &&
-                                                                                ((a[1] < b[1]) ||
-                                                                                 ((a[1] == b[1]) && (a[2] < b[2])))))); }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Edge length of the cubes used to bucket points in pnt_to_node_idx_map.
+          Two points are the same when every coordinate differs by no more than eps, so a cube of side 2*eps means at most two buckets per axis need to be
+          checked. */
+      constexpr static uft_t pnt_hash_cell = (eps > 0 ? 2*eps : static_cast<uft_t>(1));
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** An entry in the point hash -- the geometric point, the node index, and the next entry in the same bucket (or -1). */
+      struct pnt_hash_entry_t {
+          fvec3_t    pnt;
+          node_idx_t idx;
+          int        next;
       };
-      /** @endcond */
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Used to uniquify points and assign point index values */
-      typedef std::map<fvec3_t, node_idx_t, pnt_less> pnt_to_node_idx_map_t;
+      /** Entries for all points in pnt_to_node_idx_map. */
+      std::vector<pnt_hash_entry_t> pnt_hash_entries;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Maps a bucket key to the first entry in pnt_hash_entries for that bucket -- used to detect points with nearly identical geometric points in R^3 */
+      std::unordered_map<std::uint64_t, int> pnt_to_node_idx_map;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Quantize one coordinate to a bucket coordinate.  Values are clamped so that huge or infinite coordinates don't overflow. */
+      inline std::int64_t pnt_hash_quantize(uft_t x) const {
+        constexpr uft_t lim = static_cast<uft_t>(std::int64_t(1) << 52);
+        uft_t q = std::floor(x / pnt_hash_cell);
+        if ( !(q > -lim))
+          return -(std::int64_t(1) << 52);
+        if ( !(q < lim))
+          return (std::int64_t(1) << 52);
+        return static_cast<std::int64_t>(q);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Combine three bucket coordinates into a bucket key.  Different buckets may share a key -- entries are compared by coordinate anyhow. */
+      inline std::uint64_t pnt_hash_key(std::int64_t qx, std::int64_t qy, std::int64_t qz) const {
+        std::uint64_t h = static_cast<std::uint64_t>(qx) * 0x9E3779B97F4A7C15ull;
+        h = (h ^ (h >> 29)) + static_cast<std::uint64_t>(qy) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 31)) + static_cast<std::uint64_t>(qz) * 0x94D049BB133111EBull;
+        return h ^ (h >> 32);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Find the entry for a point in pnt_to_node_idx_map.
+          When more than one stored point is within eps of the given point, the one stored first wins.
+          @return Index into pnt_hash_entries, or -1 if the point is not found */
+      int pnt_hash_find(const fvec3_t& pnt) const {
+        std::int64_t lo[3], hi[3];
+        for(int i=0; i<3; ++i) {
+          lo[i] = pnt_hash_quantize(pnt[i]-eps);
+          hi[i] = pnt_hash_quantize(pnt[i]+eps);
+        }
+        int found = -1;
+        for(std::int64_t qx=lo[0]; qx<=hi[0]; ++qx)
+          for(std::int64_t qy=lo[1]; qy<=hi[1]; ++qy)
+            for(std::int64_t qz=lo[2]; qz<=hi[2]; ++qz) {
+              auto bkt = pnt_to_node_idx_map.find(pnt_hash_key(qx, qy, qz));
+              if (bkt != pnt_to_node_idx_map.end())
+                for(int e=bkt->second; e>=0; e=pnt_hash_entries[e].next)
+                  if ( !((std::abs(pnt[0]-pnt_hash_entries[e].pnt[0]) > eps) ||
+                         (std::abs(pnt[1]-pnt_hash_entries[e].pnt[1]) > eps) ||
+                         (std::abs(pnt[2]-pnt_hash_entries[e].pnt[2]) > eps)))
+                    if ((found < 0) || (e < found))
+                      found = e;
+            }
+        return found;
+      }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Maps points to point index -- used to detect points with nearly identical geometric points in R^3 */
-      pnt_to_node_idx_map_t pnt_to_node_idx_map;
+      /** Add a point known NOT to be in pnt_to_node_idx_map. */
+      void pnt_hash_push(const fvec3_t& pnt, node_idx_t idx) {
+        auto bkt = pnt_to_node_idx_map.try_emplace(pnt_hash_key(pnt_hash_quantize(pnt[0]), pnt_hash_quantize(pnt[1]), pnt_hash_quantize(pnt[2])), -1).first;
+        pnt_hash_entries.push_back({pnt, idx, bkt->second});
+        bkt->second = static_cast<int>(pnt_hash_entries.size())-1;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Map a point to a node index in pnt_to_node_idx_map.  If the point is already present, then its node index is replaced. */
+      void pnt_hash_insert(const fvec3_t& pnt, node_idx_t idx) {
+        if (int e = pnt_hash_find(pnt); e >= 0)
+          pnt_hash_entries[e].idx = idx;
+        else
+          pnt_hash_push(pnt, idx);
+      }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Type to hold a all node data. */
       typedef std::vector<node_data_t> node_idx_to_node_data_t;
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Hold all node data sets */
+      /** Hold all node data sets.
+          For MR_cc_node_store_t::VECTORS this holds one node_data_t per node.  For MR_cc_node_store_t::COLUMNS this holds one node_data_t per component.
+          Not used for MR_cc_node_store_t::FLAT. */
       node_idx_to_node_data_t node_idx_to_node_data;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Hold all node data for MR_cc_node_store_t::FLAT -- node_data_width values per node, one node after the other. */
+      node_data_t node_data_flat;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of data values in each node for MR_cc_node_store_t::FLAT & MR_cc_node_store_t::COLUMNS.  Set by the first node added. */
+      int node_data_width = -1;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of nodes for MR_cc_node_store_t::FLAT & MR_cc_node_store_t::COLUMNS. */
+      node_idx_t node_data_count = 0;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Geometric point for each node -- kept in sync with the node data and node_data_to_pnt.  See: get_pnt() */
+      fvec3_list_t node_idx_to_pnt;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Append node data to the node data store.
+          An rvalue node_data_t is moved into the store for MR_cc_node_store_t::VECTORS.
+          @return false if the node data length doesn't match the store width (MR_cc_node_store_t::FLAT & MR_cc_node_store_t::COLUMNS only) */
+      template<typename node_data_arg_t>
+      inline bool node_data_store_push(node_data_arg_t&& node_data) {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS) {
+          if constexpr (std::is_same_v<std::remove_cvref_t<node_data_arg_t>, node_data_t>)
+            node_idx_to_node_data.push_back(std::forward<node_data_arg_t>(node_data));
+          else
+            node_idx_to_node_data.emplace_back(node_data.begin(), node_data.end());
+        } else {
+          if (node_data_width < 0) {
+            node_data_width = static_cast<int>(node_data.size());
+            if constexpr (node_store == MR_cc_node_store_t::COLUMNS)
+              node_idx_to_node_data.resize(node_data.size());
+          }
+          if (static_cast<int>(node_data.size()) != node_data_width)
+            return false;
+          if constexpr (node_store == MR_cc_node_store_t::FLAT)
+            node_data_flat.insert(node_data_flat.end(), node_data.begin(), node_data.end());
+          else
+            for(int i=0; i<node_data_width; ++i)
+              node_idx_to_node_data[i].push_back(node_data[i]);
+          node_data_count++;
+        }
+        return true;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Make room in a vector for at least num_more additional elements.
+          Capacity at least doubles when it grows, so repeated small batches don't defeat the geometric growth of std::vector. */
+      template<typename vec_t>
+      static inline void reserve_more(vec_t& v, std::size_t num_more) {
+        if (v.capacity() < v.size() + num_more)
+          v.reserve(std::max(v.size() + num_more, 2 * v.capacity()));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Reserve space for num_nodes more nodes, each with node_width data values, in the node store, point cache, and point hash. */
+      void node_store_reserve(std::size_t num_nodes, std::size_t node_width) {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS) {
+          reserve_more(node_idx_to_node_data, num_nodes);
+        } else if constexpr (node_store == MR_cc_node_store_t::FLAT) {
+          reserve_more(node_data_flat, num_nodes * node_width);
+        } else {
+          for(auto& c: node_idx_to_node_data)
+            reserve_more(c, num_nodes);
+        }
+        reserve_more(node_idx_to_pnt, num_nodes);
+        if constexpr (chk_point_unique) {
+          reserve_more(pnt_hash_entries, num_nodes);
+          pnt_to_node_idx_map.reserve(pnt_to_node_idx_map.size() + num_nodes);
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Work horse for the add_node() overloads. */
+      template<typename node_data_arg_t>
+      inline node_idx_t add_node_impl(node_data_arg_t&& node_data) {
+        if (node_data_to_pnt.empty())
+          node_data_to_pnt = {0, 1, 2};
+        fvec3_t new_pnt = fvec3_from_node_data(node_data_to_pnt, node_data);
+        return add_node_pnt(std::forward<node_data_arg_t>(node_data), new_pnt, true);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Add node data with a geometric point already extracted via node_data_to_pnt.
+          When search_existing is false, the point is known not to be in the point index (See: append()), and the point lookup is skipped. */
+      template<typename node_data_arg_t>
+      inline node_idx_t add_node_pnt(node_data_arg_t&& node_data, const fvec3_t& new_pnt, bool search_existing) {
+        if (pnt_has_nan(new_pnt)) {
+          last_point_idx = -1;
+          last_point_new = false;
+        } else {
+          if constexpr (chk_point_unique) {
+            if (int e = (search_existing ? pnt_hash_find(new_pnt) : -1); e >= 0) {
+              /* Point is already in list */
+              last_point_idx = pnt_hash_entries[e].idx;
+              last_point_new = false;
+              return last_point_idx;
+            }
+          }
+          /* Point is not already in list, or we don't care about uniqueness */
+          node_idx_t new_point_idx = node_count();
+          if (node_data_store_push(std::forward<node_data_arg_t>(node_data))) {
+            node_idx_to_pnt.push_back(new_pnt);
+            if constexpr (chk_point_unique)
+              pnt_hash_push(new_pnt, new_point_idx);
+            last_point_idx = new_point_idx;
+            last_point_new = true;
+          } else {
+            std::cout << "ERROR(add_node): Node data length does not match node store width!" << std::endl;
+            last_point_idx = -1;
+            last_point_new = false;
+          }
+        }
+        return last_point_idx;
+      }
       //@}
 
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,17 +582,224 @@ namespace mjr {
       /** @name Cells. */
       //@{
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Type for a list of poly cells */
-      typedef std::vector<cell_verts_t> cell_lst_t;
+      /** Vertexes of all cells, one cell after the other (compressed row storage).  See: cell_offsets */
+      node_idx_list_t cell_conn;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Offsets into cell_conn.  The vertexes of cell i are [cell_offsets[i], cell_offsets[i+1]).  Always has num_cells()+1 elements. */
+      node_idx_list_t cell_offsets = {0};
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Kind of each cell. */
+      std::vector<cell_kind_t> cell_kinds;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Append a cell to the cell store (no checks). */
+      inline void cell_store_push(cell_kind_t new_cell_kind, cell_verts_span_t new_cell_verts) {
+        cell_conn.insert(cell_conn.end(), new_cell_verts.begin(), new_cell_verts.end());
+        cell_offsets.push_back(static_cast<node_idx_t>(cell_conn.size()));
+        cell_kinds.push_back(new_cell_kind);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Reserve space for num_new_cells more cells with a total of num_new_verts vertexes in the cell store (and unique cell index). */
+      void cell_store_reserve(std::size_t num_new_cells, std::size_t num_new_verts) {
+        reserve_more(cell_conn,    num_new_verts);
+        reserve_more(cell_offsets, num_new_cells);
+        reserve_more(cell_kinds,   num_new_cells);
+        if constexpr (chk_cell_unique)
+          uniq_cell_reserve(uniq_cell_cnt + num_new_cells);
+      }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** House all poly cells */
-      cell_lst_t cell_lst;
+      /** Work horse for cull_cells() & cull_cells_by_index().
+          @param func       Predicate function given a cell index & the cell vertexes */
+      template<typename cull_func_t>
+      int cull_cells_impl(cull_func_t&& func) {
+        int start_size = num_cells();
+        int num_good = 0;
+        node_idx_t conn_good = 0;
+        cell_verts_t cell_verts;
+        for(int i=0; i<start_size; i++) {
+          node_idx_t cell_beg = cell_offsets[i];
+          node_idx_t cell_end = cell_offsets[i+1];
+          cell_verts.assign(cell_conn.begin()+cell_beg, cell_conn.begin()+cell_end);
+          if ( !(func(i, cell_verts))) {
+            if (num_good != i) {
+              std::copy(cell_conn.begin()+cell_beg, cell_conn.begin()+cell_end, cell_conn.begin()+conn_good);
+              cell_kinds[num_good] = cell_kinds[i];
+            }
+            conn_good += (cell_end - cell_beg);
+            num_good++;
+            cell_offsets[num_good] = conn_good;
+          } else {
+            if constexpr (chk_cell_unique) {
+              uniq_cell_key_t cell_key;
+              if (uniq_cell_make_key(cell_verts, cell_key))
+                uniq_cell_erase(cell_key);
+            }
+          }
+        }
+        cell_conn.resize(conn_good);
+        cell_offsets.resize(num_good+1);
+        cell_kinds.resize(num_good);
+        return (start_size-num_cells());
+      }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Used to uniquify cells */
-      typedef std::set<cell_verts_t> uniq_cell_lst_t;
+      /** Key used to uniquify cells -- the sorted vertexes of a cell padded with uniq_cell_pad.  Key[0] is uniq_cell_pad only for an empty hash slot. */
+      typedef std::array<node_idx_t, 8> uniq_cell_key_t;
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Unique cell list. */
-      uniq_cell_lst_t uniq_cell_lst;
+      /** Padding for uniq_cell_key_t.  Not -1, because cells may have negative vertexes when chk_cell_vertexes is false. */
+      constexpr static node_idx_t uniq_cell_pad = std::numeric_limits<node_idx_t>::min();
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Unique cell index.  An open addressing hash set (linear probing) of uniq_cell_key_t.  Size is zero or a power of two. */
+      std::vector<uniq_cell_key_t> uniq_cell_lst;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of keys in uniq_cell_lst. */
+      std::size_t uniq_cell_cnt = 0;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Construct a uniq_cell_key_t from cell vertexes.
+          @return false if the cell has no vertexes, too many vertexes to fit in a key, or a vertex equal to uniq_cell_pad */
+      inline bool uniq_cell_make_key(cell_verts_span_t cell_verts, uniq_cell_key_t& key) const {
+        if (cell_verts.empty() || (cell_verts.size() > key.size()))
+          return false;
+        if (std::find(cell_verts.begin(), cell_verts.end(), uniq_cell_pad) != cell_verts.end())
+          return false;
+        key.fill(uniq_cell_pad);
+        std::copy(cell_verts.begin(), cell_verts.end(), key.begin());
+        std::sort(key.begin(), key.begin()+static_cast<std::ptrdiff_t>(cell_verts.size()));
+        return true;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Hash a uniq_cell_key_t. */
+      inline std::size_t uniq_cell_hash(const uniq_cell_key_t& key) const {
+        std::uint64_t h = 0xCBF29CE484222325ull;
+        for(auto v: key) {
+          if (v == uniq_cell_pad)
+            break;
+          h = (h ^ static_cast<std::uint32_t>(v)) * 0x100000001B3ull;
+        }
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::size_t>(h ^ (h >> 31));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Find the slot in uniq_cell_lst holding a key, or the empty slot where it would go.  uniq_cell_lst must not be empty. */
+      inline std::size_t uniq_cell_slot(const uniq_cell_key_t& key) const {
+        std::size_t mask = uniq_cell_lst.size() - 1;
+        std::size_t i = uniq_cell_hash(key) & mask;
+        while ((uniq_cell_lst[i][0] != uniq_cell_pad) && (uniq_cell_lst[i] != key))
+          i = (i + 1) & mask;
+        return i;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Grow uniq_cell_lst, if required, so that it can hold num_keys keys without exceeding a 3/4 load factor. */
+      void uniq_cell_reserve(std::size_t num_keys) {
+        if (4 * num_keys > 3 * uniq_cell_lst.size()) {
+          std::size_t new_size = std::max(std::size_t(64), 2 * uniq_cell_lst.size());
+          while (4 * num_keys > 3 * new_size)
+            new_size *= 2;
+          std::vector<uniq_cell_key_t> old_lst(new_size, uniq_cell_key_t{uniq_cell_pad});
+          std::swap(old_lst, uniq_cell_lst);
+          for(const auto& old_key: old_lst)
+            if (old_key[0] != uniq_cell_pad)
+              uniq_cell_lst[uniq_cell_slot(old_key)] = old_key;
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Add a key to uniq_cell_lst.
+          @return true if the key was new, and false if it was already present. */
+      bool uniq_cell_insert(const uniq_cell_key_t& key) {
+        uniq_cell_reserve(uniq_cell_cnt + 1);
+        std::size_t i = uniq_cell_slot(key);
+        if (uniq_cell_lst[i][0] != uniq_cell_pad)
+          return false;
+        uniq_cell_lst[i] = key;
+        uniq_cell_cnt++;
+        return true;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Remove a key from uniq_cell_lst (backward shift deletion, so no tombstones are required).
+          @return true if the key was found and removed */
+      bool uniq_cell_erase(const uniq_cell_key_t& key) {
+        if (uniq_cell_lst.empty())
+          return false;
+        std::size_t mask = uniq_cell_lst.size() - 1;
+        std::size_t i = uniq_cell_slot(key);
+        if (uniq_cell_lst[i][0] == uniq_cell_pad)
+          return false;
+        for(std::size_t j=(i+1)&mask; uniq_cell_lst[j][0] != uniq_cell_pad; j=(j+1)&mask) {
+          std::size_t home = uniq_cell_hash(uniq_cell_lst[j]) & mask;
+          // Move j into the hole at i if j's home slot is not in the cyclic range (i, j]
+          if (((j > i) && ((home <= i) || (home > j))) || ((j < i) && ((home <= i) && (home > j)))) {
+            uniq_cell_lst[i] = uniq_cell_lst[j];
+            i = j;
+          }
+        }
+        uniq_cell_lst[i][0] = uniq_cell_pad;
+        uniq_cell_cnt--;
+        return true;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Root finder used by edge_solver_sdf(). */
+      edge_solver_t edge_solver = edge_solver_t::BISECTION;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of SDF evaluations made by edge_solver_sdf(). */
+      std::size_t edge_solver_eval_cnt = 0;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of edges solved by edge_solver_sdf(). */
+      std::size_t edge_solver_solve_cnt = 0;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** An entry in edge_solver_cache -- an edge key from edge_solver_cache_key() and the index of the node solved on that edge.  */
+      struct edge_solver_cache_entry_t {
+          std::uint64_t key;
+          node_idx_t    idx;
+      };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Key used for empty slots in edge_solver_cache.  Not a valid edge key as node indexes are non-negative. */
+      constexpr static std::uint64_t edge_solver_cache_empty = ~std::uint64_t(0);
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Solution cache for edge_solver_sdf().  An open addressing hash map (linear probing).  Size is zero or a power of two. */
+      std::vector<edge_solver_cache_entry_t> edge_solver_cache;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of entries in edge_solver_cache. */
+      std::size_t edge_solver_cache_cnt = 0;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Pack an edge into a key -- the smaller node index in the high 32 bits, and the larger one in the low 32 bits. */
+      inline std::uint64_t edge_solver_cache_key(node_idx_t pnt_idx1, node_idx_t pnt_idx2) const {
+        return ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(std::min(pnt_idx1, pnt_idx2))) << 32) |
+                static_cast<std::uint64_t>(static_cast<std::uint32_t>(std::max(pnt_idx1, pnt_idx2))));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Find the slot in edge_solver_cache holding a key, or the empty slot where it would go.  edge_solver_cache must not be empty. */
+      inline std::size_t edge_solver_cache_slot(std::uint64_t key) const {
+        std::size_t mask = edge_solver_cache.size() - 1;
+        std::uint64_t h = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        std::size_t i = static_cast<std::size_t>(h ^ (h >> 31)) & mask;
+        while ((edge_solver_cache[i].key != edge_solver_cache_empty) && (edge_solver_cache[i].key != key))
+          i = (i + 1) & mask;
+        return i;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Look up an edge in edge_solver_cache.
+          @return The node index solved on the edge, or -1 if the edge is not in the cache */
+      inline node_idx_t edge_solver_cache_find(std::uint64_t key) const {
+        if (edge_solver_cache.empty())
+          return -1;
+        const auto& entry = edge_solver_cache[edge_solver_cache_slot(key)];
+        return (entry.key == key ? entry.idx : -1);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Add an edge to edge_solver_cache, or replace the node index if the edge is already present. */
+      void edge_solver_cache_insert(std::uint64_t key, node_idx_t idx) {
+        if (4 * (edge_solver_cache_cnt + 1) > 3 * edge_solver_cache.size()) {
+          std::vector<edge_solver_cache_entry_t> old_cache(std::max(std::size_t(64), 2 * edge_solver_cache.size()), {edge_solver_cache_empty, -1});
+          std::swap(old_cache, edge_solver_cache);
+          for(const auto& old_entry: old_cache)
+            if (old_entry.key != edge_solver_cache_empty)
+              edge_solver_cache[edge_solver_cache_slot(old_entry.key)] = old_entry;
+        }
+        std::size_t i = edge_solver_cache_slot(key);
+        if (edge_solver_cache[i].key == edge_solver_cache_empty)
+          edge_solver_cache_cnt++;
+        edge_solver_cache[i] = {key, idx};
+      }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** True if the last cell given to the add_cell() method was new -- i.e. not on the master cell list.
           Only updated if chk_cell_unique is true.  Value is invalid if last_cell_stat is NOT cell_stat_t::GOOD.
@@ -389,6 +811,14 @@ namespace mjr {
       cell_stat_t last_cell_stat = cell_stat_t::GOOD;
       //@}
 
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name I/O. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Significant digits for real numbers in ASCII files.  Zero means the shortest representation that round trips.  See: set_ascii_precision() */
+      int ascii_precision = 10;
+      //@}
+
     public:
 
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,12 +828,88 @@ namespace mjr {
       /** Return the number of points in the central node data list.
           Note the return type is node_idx_t (a signed integer type) and not a size_t. */
       inline node_idx_t node_count() const {
-        return static_cast<node_idx_t>(node_idx_to_node_data.size());  // Yes.  We mean node_idx_to_node_data.
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS)
+          return static_cast<node_idx_t>(node_idx_to_node_data.size());  // Yes.  We mean node_idx_to_node_data.
+        else
+          return node_data_count;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Return point given a node index */
-      inline fvec3_t get_pnt(node_idx_t pnt_idx) const { 
-        return fvec3_from_node_data(node_data_to_pnt, node_idx_to_node_data[pnt_idx]); 
+      /** Return the number of data values stored for a node. */
+      inline int node_data_size(node_idx_t pnt_idx) const {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS)
+          return static_cast<int>(node_idx_to_node_data[pnt_idx].size());
+        else
+          return node_data_width;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Return one data value from a node without copying the node data.
+          @param pnt_idx  Node index
+          @param data_idx Index into the node's data */
+      inline uft_t get_node_data_value(node_idx_t pnt_idx, int data_idx) const {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS)
+          return node_idx_to_node_data[pnt_idx][data_idx];
+        else if constexpr (node_store == MR_cc_node_store_t::FLAT)
+          return node_data_flat[static_cast<std::size_t>(pnt_idx) * static_cast<std::size_t>(node_data_width) + static_cast<std::size_t>(data_idx)];
+        else
+          return node_idx_to_node_data[data_idx][pnt_idx];
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Set one data value for a node.
+          Note the geometric point is *not* re-checked for uniqueness.
+          @param pnt_idx  Node index
+          @param data_idx Index into the node's data
+          @param value    New value */
+      inline void set_node_data_value(node_idx_t pnt_idx, int data_idx, uft_t value) {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS)
+          node_idx_to_node_data[pnt_idx][data_idx] = value;
+        else if constexpr (node_store == MR_cc_node_store_t::FLAT)
+          node_data_flat[static_cast<std::size_t>(pnt_idx) * static_cast<std::size_t>(node_data_width) + static_cast<std::size_t>(data_idx)] = value;
+        else
+          node_idx_to_node_data[data_idx][pnt_idx] = value;
+        for(int i=0; i<3; ++i)
+          if ((node_data_to_pnt[i].index() == 0) && (std::get<int>(node_data_to_pnt[i]) == data_idx))
+            node_idx_to_pnt[pnt_idx][i] = value;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Return the data for a node.
+          For MR_cc_node_store_t::VECTORS this is a reference to the stored data.  For the other node stores a new node_data_t is assembled.
+          @param pnt_idx  Node index */
+      inline decltype(auto) get_node_data(node_idx_t pnt_idx) const {
+        if constexpr (node_store == MR_cc_node_store_t::VECTORS) {
+          return static_cast<const node_data_t&>(node_idx_to_node_data[pnt_idx]);
+        } else {
+          node_data_t node_data(static_cast<std::size_t>(node_data_width));
+          for(int i=0; i<node_data_width; ++i)
+            node_data[i] = get_node_data_value(pnt_idx, i);
+          return node_data;
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Extract a uft_t from the data for a node.
+          @param data_idx  Index used to identify the data to pull
+          @param pnt_idx   Node index */
+      inline uft_t scalar_from_node(const node_data_idx_t& data_idx, node_idx_t pnt_idx) const {
+        if (data_idx.index() == 0)
+          return get_node_data_value(pnt_idx, std::get<int>(data_idx));
+        else
+          return std::get<uft_t>(data_idx);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Construct a fvec3_t from the data for a node.
+          See: fvec3_from_node_data()
+          @param data_idx_lst  Index list used to identify the data to pull
+          @param pnt_idx       Node index */
+      inline fvec3_t fvec3_from_node(const node_data_idx_lst_t& data_idx_lst, node_idx_t pnt_idx) const {
+        fvec3_t v;
+        for(int i=0; i<3; ++i)
+          v[i] = scalar_from_node(data_idx_lst.at(i), pnt_idx);
+        return v;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Return point given a node index.
+          Points are cached when nodes are added, so this is just a lookup. */
+      inline const fvec3_t& get_pnt(node_idx_t pnt_idx) const { 
+        return node_idx_to_pnt[pnt_idx];
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Retruns the index of the last point given to the add_node() method. */
@@ -430,37 +936,54 @@ namespace mjr {
           Case 3: If the geometric point is not on the list, then the point is added to the central node data store, last_point_idx is set to the new point's
           index, and last_point_new=true Note that last_point_idx is always the return value.
 
+          For the MR_cc_node_store_t::FLAT & MR_cc_node_store_t::COLUMNS node stores, node data with a length different from the first node added is
+          rejected just like Case 1 (an error message is printed).
+
           @param node_data The point to add! */
-      inline node_idx_t add_node(node_data_t node_data) {
-        if (node_data_to_pnt.empty())
-          node_data_to_pnt = {0, 1, 2};
-        fvec3_t new_pnt = fvec3_from_node_data(node_data_to_pnt, node_data);
-        if (pnt_has_nan(new_pnt)) {
-          last_point_idx = -1;
-          last_point_new = false;
-        } else {
-          if constexpr (chk_point_unique) {
-            if (pnt_to_node_idx_map.contains(new_pnt)) {
-              /* Point is already in list */
-              last_point_idx = pnt_to_node_idx_map[new_pnt];
-              last_point_new = false;
-            } else {
-              /* Point is not already in list */
-              last_point_idx = node_count();
-              pnt_to_node_idx_map[new_pnt] = last_point_idx;
-              //node_idx_to_pnt.push_back(new_pnt);
-              node_idx_to_node_data.push_back(node_data);
-              last_point_new = true;
-            }
-          } else {
-            /* Add point without regard to uniqueness */
-            last_point_idx = node_count();
-            //node_idx_to_pnt.push_back(new_pnt);
-            node_idx_to_node_data.push_back(node_data);
-            last_point_new = true;
-          }
+      inline node_idx_t add_node(const node_data_t& node_data) {
+        return add_node_impl(node_data);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload
+          The node data is moved into the store when possible (MR_cc_node_store_t::VECTORS). */
+      inline node_idx_t add_node(node_data_t&& node_data) {
+        return add_node_impl(std::move(node_data));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload */
+      inline node_idx_t add_node(std::span<const uft_t> node_data) {
+        return add_node_impl(node_data);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Add several points to the central node data store.
+          Space for all the nodes is reserved up front, and then each node is added exactly as with add_node().
+          @param nodes The points to add
+          @return The index of each node as returned by add_node() -- i.e. -1 for rejected nodes */
+      node_idx_list_t add_nodes(std::span<const node_data_t> nodes) {
+        node_idx_list_t node_idxs;
+        node_idxs.reserve(nodes.size());
+        node_store_reserve(nodes.size(), (nodes.empty() ? 0 : nodes.front().size()));
+        for(const auto& node_data: nodes)
+          node_idxs.push_back(add_node_impl(node_data));
+        return node_idxs;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload
+          @param flat_node_data Node data for all the points, node_width values per point, one point after the other
+          @param node_width     Number of data values in each point
+          @return The index of each node as returned by add_node().  Empty if flat_node_data.size() is not a multiple of node_width. */
+      node_idx_list_t add_nodes(std::span<const uft_t> flat_node_data, int node_width) {
+        node_idx_list_t node_idxs;
+        if ((node_width <= 0) || ((flat_node_data.size() % static_cast<std::size_t>(node_width)) != 0)) {
+          std::cout << "ERROR(add_nodes): Node data length is not a multiple of node width!" << std::endl;
+          return node_idxs;
         }
-        return last_point_idx;
+        std::size_t num_nodes = flat_node_data.size() / static_cast<std::size_t>(node_width);
+        node_idxs.reserve(num_nodes);
+        node_store_reserve(num_nodes, static_cast<std::size_t>(node_width));
+        for(std::size_t i=0; i<flat_node_data.size(); i+=static_cast<std::size_t>(node_width))
+          node_idxs.push_back(add_node_impl(flat_node_data.subspan(i, static_cast<std::size_t>(node_width))));
+        return node_idxs;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Construct a fvec3_t from a node_data_t and a node_data_idx_lst_t.
@@ -469,37 +992,32 @@ namespace mjr {
           this function will throw.
           @param data_idx_lst  Index list used to identify the data to pull
           @param node_data      node data vector from which to pull data */
-      inline fvec3_t fvec3_from_node_data(node_data_idx_lst_t data_idx_lst, node_data_t node_data) const {
+      inline fvec3_t fvec3_from_node_data(const node_data_idx_lst_t& data_idx_lst, std::span<const uft_t> node_data) const {
         fvec3_t v;
         for(int i=0; i<3; ++i)
-          if (data_idx_lst[i].index() == 0)
-            v[i] = node_data[std::get<int>(data_idx_lst.at(i))];
-          else
-            v[i] = std::get<uft_t>(data_idx_lst.at(i));
+          v[i] = scalar_from_node_data(data_idx_lst.at(i), node_data);
         return v;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Construct a vdat_t from a node_data_t and a node_data_idx_lst_t.
           @param data_idx_lst  Index list used to identify the data to pull
           @param node_data      node data vector from which to pull data */
-      inline vdat_t vector_from_node_data(node_data_idx_lst_t data_idx_lst, node_data_t node_data) const {
+      inline vdat_t vector_from_node_data(const node_data_idx_lst_t& data_idx_lst, std::span<const uft_t> node_data) const {
         vdat_t v;
-        for(decltype(data_idx_lst.size()) i=0; i<data_idx_lst.size(); ++i)
-          if (data_idx_lst[i].index() == 0)
-            v.push_back(node_data[std::get<int>(data_idx_lst.at(i))]);
-          else
-            v.push_back(std::get<uft_t>(data_idx_lst.at(i)));
+        v.reserve(data_idx_lst.size());
+        for(const auto& data_idx : data_idx_lst)
+          v.push_back(scalar_from_node_data(data_idx, node_data));
         return v;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Extract a uft_t from a node_data_t and a node_data_idx_t.
           @param data_idx  Index list used to identify the data to pull
           @param node_data  node data vector from which to pull data */
-      inline uft_t scalar_from_node_data(node_data_idx_t data_idx, node_data_t node_data) const {
+      inline uft_t scalar_from_node_data(const node_data_idx_t& data_idx, std::span<const uft_t> node_data) const {
         if (data_idx.index() == 0)
           return (node_data[std::get<int>(data_idx)]);
         else
-          return (std::get<int>(data_idx));
+          return (std::get<uft_t>(data_idx));
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Convert a fvec3_t to a string representation
@@ -508,8 +1026,8 @@ namespace mjr {
         std::ostringstream convert;
         if (pnt_idx >= 0) {
           convert << "[ ";
-          for(auto c: node_idx_to_node_data[pnt_idx]) 
-            convert << std::setprecision(5) << static_cast<uft_t>(c) << " ";
+          for(int i=0; i<node_data_size(pnt_idx); ++i)
+            convert << std::setprecision(5) << get_node_data_value(pnt_idx, i) << " ";
           convert << "]";
         } else {
           convert << "[ DNE ]";
@@ -543,6 +1061,11 @@ namespace mjr {
         data_name_to_data_idx_lst = names;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Retruns the named data sets (See: set_data_name_to_data_idx_lst()). */
+      inline const data_name_to_node_data_idx_lst_t& get_data_name_to_data_idx_lst() const {
+        return data_name_to_data_idx_lst;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Create named data sets.
           Simple way to create named scalar datasets for the first n elements in each point's data.
           @param scalar_name_strings Scalar data set names to apply, in order, to node data elements. */
@@ -564,11 +1087,13 @@ namespace mjr {
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Create mapping beteen node data and geometric pionts.
-          Geometric points are constructed from node data via a node_data_idx_lst_t -- just like named data sets.  Each time a geometric point is required,
-          it is dynamically pulled from the point's data via this mapping.
+          Geometric points are constructed from node data via a node_data_idx_lst_t -- just like named data sets.  The points are cached when nodes are
+          added, and the cache is rebuilt for all existing nodes when this function is called.  Note the point uniqueness index is not rebuilt.
           @param point_data_index A node_data_idx_lst_t defining how to construct a geometric point. */
       inline void create_dataset_to_point_mapping(node_data_idx_lst_t point_data_index) {
         node_data_to_pnt = point_data_index;
+        for(node_idx_t i=0; i<static_cast<node_idx_t>(node_idx_to_pnt.size()); ++i)
+          node_idx_to_pnt[i] = fvec3_from_node(node_data_to_pnt, i);
       }
       //@}
 
@@ -684,6 +1209,11 @@ namespace mjr {
         return std::string(""); // Never get here, but some compilers can't figure that out. ;)
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Count the number of distinct values among four indexes. */
+      inline int count_unique_idx(node_idx_t i1, node_idx_t i2, node_idx_t i3, node_idx_t i4) const {
+        return (1 + (i2 != i1) + ((i3 != i1) && (i3 != i2)) + ((i4 != i1) && (i4 != i2) && (i4 != i3)));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Determine the nature of the intersection between two line segments */
       seg_isect_t geomi_seg_isect_type(node_idx_t ilin1pnt1, node_idx_t ilin1pnt2, node_idx_t ilin2pnt1, node_idx_t ilin2pnt2) const {
         //  MJR TODO NOTE <2024-08-02T09:41:48-0500> geomi_seg_isect_type: Repeated point look-up slows things down
@@ -694,12 +1224,8 @@ namespace mjr {
         if (ilin2pnt1 == ilin2pnt2)
           return seg_isect_t::BAD_SEGMENT;
         // Count unique points & break into cases
-        std::set<node_idx_t> points_sorted;
-        points_sorted.insert(ilin1pnt1);
-        points_sorted.insert(ilin1pnt2);
-        points_sorted.insert(ilin2pnt1);
-        points_sorted.insert(ilin2pnt2);
-        if (points_sorted.size() == 4) { // ...................................................... REMAINING CASES: C0_EMPTY, C1_INTERIOR, CI_VERTEX0
+        int num_unique = count_unique_idx(ilin1pnt1, ilin1pnt2, ilin2pnt1, ilin2pnt2);
+        if (num_unique == 4) { // ...................................................... REMAINING CASES: C0_EMPTY, C1_INTERIOR, CI_VERTEX0
           if (geomi_pts_colinear(ilin1pnt1, ilin1pnt2, ilin2pnt1, ilin2pnt2)) { // ............... REMAINING CASES: C0_EMPTY,              CI_VERTEX0
             if ( (geomi_pnt_line_distance(ilin1pnt1, ilin1pnt2, ilin2pnt1, true) < eps) ||
                  (geomi_pnt_line_distance(ilin1pnt1, ilin1pnt2, ilin2pnt2, true) < eps) ||
@@ -717,7 +1243,7 @@ namespace mjr {
             }
           }
           return seg_isect_t::C0_EMPTY;
-        } else if (points_sorted.size() == 3) { // .............................................. REMAINING CASES: C1_VERTEX1, CI_VERTEX1
+        } else if (num_unique == 3) { // .............................................. REMAINING CASES: C1_VERTEX1, CI_VERTEX1
           node_idx_t ipnt1, ipnt2, ipntc;
           if (ilin1pnt1 == ilin2pnt1) {
             ipntc = ilin1pnt1; ipnt1 = ilin1pnt2; ipnt2 = ilin2pnt2;
@@ -740,9 +1266,9 @@ namespace mjr {
           } else { // ........................................................................... REMAINING CASES: C1_VERTEX1
             return seg_isect_t::C1_VERTEX1;
           }
-        } else if (points_sorted.size() == 2) { // .............................................. REMAINING CASES: CI_VERTEX2
+        } else if (num_unique == 2) { // .............................................. REMAINING CASES: CI_VERTEX2
           return seg_isect_t::CI_VERTEX2;
-        } else { // (points_sorted.size() == 1) which is an error. // ........................... REMAINING CASES: CI_VERTEX2
+        } else { // (num_unique == 1) which is an error. // ........................... REMAINING CASES: CI_VERTEX2
           return seg_isect_t::CI_VERTEX2;
         }
         return seg_isect_t::C0_EMPTY;  // Should never get here...
@@ -881,7 +1407,7 @@ namespace mjr {
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Check if points are coplanar */
-      inline bool geomi_pts_coplanar(const node_idx_list_t& pnt_list) const {
+      inline bool geomi_pts_coplanar(std::span<const node_idx_t> pnt_list) const {
         if (pnt_list.size() > 3) {
           if ( !(geomi_pts_coplanar(pnt_list[0], pnt_list[1], pnt_list[2], pnt_list[3])))
             return false;
@@ -918,30 +1444,100 @@ namespace mjr {
         last_point_idx = -1;
         last_point_new = true;
         pnt_to_node_idx_map.clear();
+        pnt_hash_entries.clear();
         node_idx_to_node_data.clear();
+        node_data_flat.clear();
+        node_data_width = -1;
+        node_data_count = 0;
+        node_idx_to_pnt.clear();
         data_name_to_data_idx_lst.clear();
         node_data_to_pnt.clear();
-        cell_lst.clear();
+        cell_conn.clear();
+        cell_offsets.assign(1, 0);
+        cell_kinds.clear();
         uniq_cell_lst.clear();
+        uniq_cell_cnt = 0;
+        clear_cache_edge_solver_sdf();
         last_cell_new = true;
         last_cell_stat = cell_stat_t::GOOD;
       }
       //@}
 
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Threads. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of threads parallel_for() will use for num_items items.
+          @param num_items   Number of items
+          @param num_threads Maximum number of threads.  Zero means std::thread::hardware_concurrency(). */
+      static int parallel_for_threads(std::size_t num_items, int num_threads) {
+        if (num_threads <= 0)
+          num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        return static_cast<int>(std::max(std::size_t(1), std::min(num_items, static_cast<std::size_t>(num_threads))));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Split [0, num_items) into contiguous chunks, and call func(begin, end, thread_idx) for each chunk on its own thread.
+          The work is done on the calling thread when only one thread is required.  Used by MR_cell_cplx & MR_rt_to_cc.
+          @param num_items   Number of items
+          @param num_threads Maximum number of threads.  Zero means std::thread::hardware_concurrency().
+          @param func        Work function */
+      template<typename func_t>
+      static void parallel_for(std::size_t num_items, int num_threads, func_t&& func) {
+        int real_num_threads = parallel_for_threads(num_items, num_threads);
+        if (real_num_threads == 1) {
+          func(std::size_t(0), num_items, 0);
+        } else {
+          std::vector<std::thread> threads;
+          threads.reserve(static_cast<std::size_t>(real_num_threads));
+          for(int thread_idx=0; thread_idx<real_num_threads; ++thread_idx) {
+            std::size_t begin = num_items * static_cast<std::size_t>(thread_idx)   / static_cast<std::size_t>(real_num_threads);
+            std::size_t end   = num_items * static_cast<std::size_t>(thread_idx+1) / static_cast<std::size_t>(real_num_threads);
+            threads.emplace_back([&func, begin, end, thread_idx]() { func(begin, end, thread_idx); });
+          }
+          for(auto& t: threads)
+            t.join();
+        }
+      }
+      //@}
+
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       /** @name Cells. */
       //@{
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** One part (vertex, segment, face, etc...) of a cell -- the indexes of the part's vertexes in the cell's vertex list. */
+      struct cell_part_t {
+          int                    num_verts;
+          std::array<int, 8>     verts;
+          constexpr int size() const                 { return num_verts; }
+          constexpr int operator[](int i) const      { return verts[i]; }
+          constexpr const int* begin() const         { return verts.data(); }
+          constexpr const int* end() const           { return verts.data()+num_verts; }
+      };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Cell segment/face/etc structure.  */
-      typedef cell_lst_t cell_structure_t;
+      typedef std::span<const cell_part_t> cell_structure_t;
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Number of cells. */
       inline int num_cells() const {
-        return static_cast<int>(cell_lst.size());
+        return static_cast<int>(cell_kinds.size());
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Vertexes of a cell.
+          The returned span points into the cell store, and is invalidated when cells are added or removed.
+          @param cell_idx Index of the cell */
+      inline cell_verts_span_t get_cell_verts(int cell_idx) const {
+        return cell_verts_span_t(cell_conn.data() + cell_offsets[cell_idx], static_cast<std::size_t>(cell_offsets[cell_idx+1] - cell_offsets[cell_idx]));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Kind of a cell.
+          @param cell_idx Index of the cell */
+      inline cell_kind_t get_cell_kind(int cell_idx) const {
+        return cell_kinds[cell_idx];
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Convert cell_kind_t value to a list of vertexes. */
-      inline cell_structure_t& cell_kind_to_structure(cell_kind_t cell_kind, int dimension) const {
+      /** Convert cell_kind_t value to a list of vertexes.
+          The parts are indexes into the vertex list of a cell.  The tables are constexpr, so no allocation happens here. */
+      inline cell_structure_t cell_kind_to_structure(cell_kind_t cell_kind, int dimension) const {
         //  MJR TODO NOTE <2024-07-11T16:06:42-0500> cell_kind_to_structure: make sure polygons are all oriented correctly
         int logical_dim = cell_kind_to_dimension(cell_kind);
         if ( (dimension < 0) || (dimension > logical_dim) )
@@ -950,54 +1546,58 @@ namespace mjr {
           std::cerr << "MR_cell_cplx API USAGE ERROR: Maximum supported dimension is 3" << std::endl;
           exit(0);
         }
-        int idx = 0;
-        switch(cell_kind) {
-          case cell_kind_t::POINT:       idx = 0; break;
-          case cell_kind_t::SEGMENT:     idx = 1; break;
-          case cell_kind_t::TRIANGLE:    idx = 2; break;
-          case cell_kind_t::QUAD:        idx = 3; break;
-          case cell_kind_t::PYRAMID:     idx = 4; break;
-          case cell_kind_t::HEXAHEDRON:  idx = 5; break;
-        }
-        static std::vector<std::vector<cell_structure_t>> cst = {{{{0}},                             // vertex
-                                                                  {{0},{1}},                         // segment
-                                                                  {{0},{1},{2}},                     // triangle
-                                                                  {{0},{1},{2},{3}},                 // Quad
-                                                                  {{0},{1},{2},{3},                  // Pyramid: Base vertexes
-                                                                   {4}},                             // Pyramid: Tip vertex
-                                                                  {{0},{1},{2},{3},                  // Hexahedron: Back vertexes
-                                                                   {4},{5},{6},{7}}},                // Hexahedron: Front vertexes
-                                                                 {{},                                // vertex
-                                                                  {{0,1}},                           // segment
-                                                                  {{0,1},{1,2},{2,0}},               // triangle
-                                                                  {{0,1},{1,2},{2,3},{3,0}},         // Quad
-                                                                  {{0,1},{1,2},{2,3},{3,0},          // Pyramid: Base segments
-                                                                   {0,4},{1,4},{2,4},{3,4}},         // Pyramid: Side sets
-                                                                  {{0,1},{1,2},{2,3},{3,0},          // Hexahedron: Back segments
-                                                                   {4,5},{5,6},{6,7},{7,4},          // Hexahedron: Front segments
-                                                                   {0,4},{1,5},{2,6},{3,7}}},        // Hexahedron: Back to front segments
-                                                                 {{},                                // vertex
-                                                                  {},                                // segment
-                                                                  {{0,1,2}},                         // triangle
-                                                                  {{0,1,2,3}},                       // Quad
-                                                                  {{0,1,2,3},                        // Pyramid: Base face
-                                                                   {0,1,4},                          // Pyramid: Back face
-                                                                   {1,2,4},                          // Pyramid: Left face
-                                                                   {2,3,4},                          // Pyramid: Front face
-                                                                   {3,0,4}},                         // Pyramid: Right faces
-                                                                  {{0,1,2,3},                        // Hexahedron: Back face
-                                                                   {4,5,6,7},                        // Hexahedron: Front face
-                                                                   {0,3,7,4},                        // Hexahedron: Left face
-                                                                   {2,3,7,6},                        // Hexahedron: Top face
-                                                                   {1,2,6,5},                        // Hexahedron: Right face
-                                                                   {0,1,4,5}}},                      // Hexahedron: Bottom face
-                                                                 {{},                                // vertex
-                                                                  {},                                // segment
-                                                                  {},                                // triangle
-                                                                  {},                                // Quad
-                                                                  {{0,1,2,3,4}},                     // Pyramid
-                                                                  {{0,1,2,3,4,5,6,7}}}};             // Hexahedron
-        return (cst[dimension][idx]);
+        static constexpr cell_part_t cst_v[]  = {{1, {0}}, {1, {1}}, {1, {2}}, {1, {3}}, {1, {4}}, {1, {5}}, {1, {6}}, {1, {7}}};
+        static constexpr cell_part_t cst_s[]  = {{2, {0,1}}};                                                          // segment
+        static constexpr cell_part_t cst_ts[] = {{2, {0,1}}, {2, {1,2}}, {2, {2,0}}};                                  // triangle
+        static constexpr cell_part_t cst_qs[] = {{2, {0,1}}, {2, {1,2}}, {2, {2,3}}, {2, {3,0}}};                      // Quad
+        static constexpr cell_part_t cst_ps[] = {{2, {0,1}}, {2, {1,2}}, {2, {2,3}}, {2, {3,0}},                       // Pyramid: Base segments
+                                                 {2, {0,4}}, {2, {1,4}}, {2, {2,4}}, {2, {3,4}}};                      // Pyramid: Side sets
+        static constexpr cell_part_t cst_hs[] = {{2, {0,1}}, {2, {1,2}}, {2, {2,3}}, {2, {3,0}},                       // Hexahedron: Back segments
+                                                 {2, {4,5}}, {2, {5,6}}, {2, {6,7}}, {2, {7,4}},                       // Hexahedron: Front segments
+                                                 {2, {0,4}}, {2, {1,5}}, {2, {2,6}}, {2, {3,7}}};                      // Hexahedron: Back to front segments
+        static constexpr cell_part_t cst_tf[] = {{3, {0,1,2}}};                                                        // triangle
+        static constexpr cell_part_t cst_qf[] = {{4, {0,1,2,3}}};                                                      // Quad
+        static constexpr cell_part_t cst_pf[] = {{4, {0,1,2,3}},                                                       // Pyramid: Base face
+                                                 {3, {0,1,4}},                                                         // Pyramid: Back face
+                                                 {3, {1,2,4}},                                                         // Pyramid: Left face
+                                                 {3, {2,3,4}},                                                         // Pyramid: Front face
+                                                 {3, {3,0,4}}};                                                        // Pyramid: Right faces
+        static constexpr cell_part_t cst_hf[] = {{4, {0,1,2,3}},                                                       // Hexahedron: Back face
+                                                 {4, {4,5,6,7}},                                                       // Hexahedron: Front face
+                                                 {4, {0,3,7,4}},                                                       // Hexahedron: Left face
+                                                 {4, {2,3,7,6}},                                                       // Hexahedron: Top face
+                                                 {4, {1,2,6,5}},                                                       // Hexahedron: Right face
+                                                 {4, {0,1,4,5}}};                                                      // Hexahedron: Bottom face
+        static constexpr cell_part_t cst_p[]  = {{5, {0,1,2,3,4}}};                                                    // Pyramid
+        static constexpr cell_part_t cst_h[]  = {{8, {0,1,2,3,4,5,6,7}}};                                              // Hexahedron
+        int num_verts = cell_kind_to_req_pt_cnt(cell_kind);
+        switch(dimension) {
+          case 0: return cell_structure_t(cst_v, static_cast<std::size_t>(num_verts));
+          case 1: switch(cell_kind) {
+                    case cell_kind_t::SEGMENT:     return cell_structure_t(cst_s);
+                    case cell_kind_t::TRIANGLE:    return cell_structure_t(cst_ts);
+                    case cell_kind_t::QUAD:        return cell_structure_t(cst_qs);
+                    case cell_kind_t::PYRAMID:     return cell_structure_t(cst_ps);
+                    case cell_kind_t::HEXAHEDRON:  return cell_structure_t(cst_hs);
+                    default:                       break;
+                  }
+                  break;
+          case 2: switch(cell_kind) {
+                    case cell_kind_t::TRIANGLE:    return cell_structure_t(cst_tf);
+                    case cell_kind_t::QUAD:        return cell_structure_t(cst_qf);
+                    case cell_kind_t::PYRAMID:     return cell_structure_t(cst_pf);
+                    case cell_kind_t::HEXAHEDRON:  return cell_structure_t(cst_hf);
+                    default:                       break;
+                  }
+                  break;
+          case 3: switch(cell_kind) {
+                    case cell_kind_t::PYRAMID:     return cell_structure_t(cst_p);
+                    case cell_kind_t::HEXAHEDRON:  return cell_structure_t(cst_h);
+                    default:                       break;
+                  }
+                  break;
+        }
+        return cell_structure_t();
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Convert cell_kind_t value to the logical dimension of the cell.
@@ -1029,17 +1629,10 @@ namespace mjr {
         return -1;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Convert cell_kind_t value to the VTK cell type integer. */
-      inline int cell_kind_to_vtk_type(cell_kind_t cell_kind) const {
-        switch(cell_kind) {
-          case cell_kind_t::POINT:       return ( 1); break;
-          case cell_kind_t::SEGMENT:     return ( 3); break;
-          case cell_kind_t::TRIANGLE:    return ( 5); break;
-          case cell_kind_t::QUAD:        return ( 9); break;
-          case cell_kind_t::HEXAHEDRON:  return (12); break;
-          case cell_kind_t::PYRAMID:     return (14); break;
-        }
-        return -1;
+      /** Convert cell_kind_t value to the VTK cell type integer.
+          The cell_kind_t values are the VTK type integers, so this is just a cast. */
+      inline static int cell_kind_to_vtk_type(cell_kind_t cell_kind) {
+        return static_cast<int>(cell_kind);
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Convert cell_kind_t value to the VTK cell type integer. */
@@ -1100,7 +1693,7 @@ namespace mjr {
 
           @param cell_kind  The type of the potential cell.
           @param cell_verts The vertexes of the potential cell.  */
-      inline cell_stat_t check_cell_vertexes(cell_kind_t cell_kind, cell_verts_t cell_verts) const {
+      inline cell_stat_t check_cell_vertexes(cell_kind_t cell_kind, cell_verts_span_t cell_verts) const {
         // Check number of points
         std::vector<int>::size_type num_verts   = cell_verts.size();
         std::vector<int>::size_type req_num_pts = cell_kind_to_req_pt_cnt(cell_kind);
@@ -1109,20 +1702,16 @@ namespace mjr {
         if (num_verts > req_num_pts)
           return cell_stat_t::TOO_MANY_PNT;
         // Check for negative point index
-        if (std::any_of(cell_verts.cbegin(), cell_verts.cend(), [](node_idx_t i) { return (i < 0); }))
+        if (std::any_of(cell_verts.begin(), cell_verts.end(), [](node_idx_t i) { return (i < 0); }))
           return cell_stat_t::NEG_PNT_IDX;
         // Check for too big point index
-        if (std::any_of(cell_verts.cbegin(), cell_verts.cend(), [this](node_idx_t i) { return (i >= node_count()); }))
+        if (std::any_of(cell_verts.begin(), cell_verts.end(), [this](node_idx_t i) { return (i >= node_count()); }))
           return cell_stat_t::BIG_PNT_IDX;
-        // Check for duplicate points
-        if (num_verts > 1) {
-          std::set<node_idx_t> cell_verts_sorted;
-          for(node_idx_t pnt_idx: cell_verts) {
-            if (cell_verts_sorted.contains(pnt_idx))
+        // Check for duplicate points.  At most 8 vertexes, so a quadratic search is faster than sorting.
+        for(std::size_t i=1; i<num_verts; i++)
+          for(std::size_t j=0; j<i; j++)
+            if (cell_verts[i] == cell_verts[j])
               return cell_stat_t::DUP_PNT;
-            cell_verts_sorted.insert(pnt_idx);
-          }
-        }
         // Return GOOD
         return cell_stat_t::GOOD;
       }
@@ -1135,7 +1724,7 @@ namespace mjr {
 
           @param cell_kind  The type of the potential cell.
           @param cell_verts The vertexes of the potential cell.  */
-      inline cell_stat_t check_cell_dimension(cell_kind_t cell_kind, cell_verts_t cell_verts) const {
+      inline cell_stat_t check_cell_dimension(cell_kind_t cell_kind, cell_verts_span_t cell_verts) const {
         if (cell_kind == cell_kind_t::TRIANGLE) {
           if (geomi_pts_colinear(cell_verts[0], cell_verts[1], cell_verts[2]))
             return cell_stat_t::DIM_LOW;
@@ -1165,21 +1754,17 @@ namespace mjr {
 
           @param cell_kind  The type of the potential cell.
           @param cell_verts The vertexes of the potential cell.  */
-      inline cell_stat_t check_cell_edge_intersections(cell_kind_t cell_kind, cell_verts_t cell_verts) const {
-        cell_structure_t& segs = cell_kind_to_structure(cell_kind, 1);
+      inline cell_stat_t check_cell_edge_intersections(cell_kind_t cell_kind, cell_verts_span_t cell_verts) const {
+        cell_structure_t segs = cell_kind_to_structure(cell_kind, 1);
         if ( !(segs.empty())) {
           for(decltype(segs.size()) i=0; i<segs.size()-1; i++) {
             for(decltype(segs.size()) j=i+1; j<segs.size(); j++) {
-              std::set<node_idx_t> points_sorted;
-              points_sorted.insert(segs[i][0]);
-              points_sorted.insert(segs[i][1]);
-              points_sorted.insert(segs[j][0]);
-              points_sorted.insert(segs[j][1]);
+              int num_unique = count_unique_idx(segs[i][0], segs[i][1], segs[j][0], segs[j][1]);
               auto it = geomi_seg_isect_type(cell_verts[segs[i][0]], cell_verts[segs[i][1]], cell_verts[segs[j][0]], cell_verts[segs[j][1]]);
-              if(points_sorted.size() == 4) {
+              if(num_unique == 4) {
                 if (it != seg_isect_t::C0_EMPTY)
                   return cell_stat_t::BAD_EDGEI;
-              } else if(points_sorted.size() == 3) {
+              } else if(num_unique == 3) {
                 if (it != seg_isect_t::C1_VERTEX1)
                   return cell_stat_t::BAD_EDGEI;
               } else {
@@ -1195,7 +1780,7 @@ namespace mjr {
 
           @param cell_kind  The type of the potential cell.
           @param cell_verts The vertexes of the potential cell.  */
-      inline cell_stat_t check_cell_face_intersections(cell_kind_t cell_kind, cell_verts_t cell_verts) const {
+      inline cell_stat_t check_cell_face_intersections(cell_kind_t cell_kind, cell_verts_span_t cell_verts) const {
         //  MJR TODO NOTE <2024-08-02T09:42:38-0500> check_cell_face_intersections: Implement
         if (cell_kind == cell_kind_t::HEXAHEDRON) {
           if ( geomi_pts_coplanar(cell_verts))
@@ -1218,13 +1803,13 @@ namespace mjr {
 
           @param cell_kind  The type of the potential cell.
           @param cell_verts The vertexes of the potential cell.  */
-      inline cell_stat_t check_cell_faces_plainer(cell_kind_t cell_kind, cell_verts_t cell_verts) const {
-        const cell_structure_t& face_structures = cell_kind_to_structure(cell_kind, 2);
-        for(auto face_structure: face_structures) {
-          cell_verts_t face;
-          for(auto idx: face_structure)
-            face.push_back(cell_verts[idx]);
-          if ( !(geomi_pts_coplanar(face)))
+      inline cell_stat_t check_cell_faces_plainer(cell_kind_t cell_kind, cell_verts_span_t cell_verts) const {
+        cell_structure_t face_structures = cell_kind_to_structure(cell_kind, 2);
+        for(const auto& face_structure: face_structures) {
+          std::array<node_idx_t, 8> face;
+          for(int i=0; i<face_structure.size(); i++)
+            face[i] = cell_verts[face_structure[i]];
+          if ( !(geomi_pts_coplanar(cell_verts_span_t(face.data(), static_cast<std::size_t>(face_structure.size())))))
             return cell_stat_t::FACE_BENT;
         }
         return cell_stat_t::GOOD;
@@ -1242,31 +1827,41 @@ namespace mjr {
           @param new_cell_verts  The vertexes of the new cell
           @param dimension The dimension of the parts to add.
           @return Number of cells added */
-      inline int add_cell(cell_kind_t new_cell_kind, cell_verts_t new_cell_verts, int dimension) {
+      inline int add_cell(cell_kind_t new_cell_kind, cell_verts_span_t new_cell_verts, int dimension) {
         int num_added = 0;
         if ( (dimension < 0) || (dimension >= cell_kind_to_dimension(new_cell_kind)) ) {
           if (add_cell(new_cell_kind, new_cell_verts))
             num_added++;
         } else { // We need to break the cell up into lower dimensional bits, and add the bits.
-          const cell_structure_t& cell_parts = cell_kind_to_structure(new_cell_kind, dimension);
-          for(auto cell_part: cell_parts) {
-            cell_verts_t newer_cell_verts;
-            for(auto idx: cell_part)
-              newer_cell_verts.push_back(new_cell_verts[idx]);
-            if (add_cell(req_pt_cnt_to_cell_kind(newer_cell_verts.size()), newer_cell_verts))
+          cell_structure_t cell_parts = cell_kind_to_structure(new_cell_kind, dimension);
+          for(const auto& cell_part: cell_parts) {
+            std::array<node_idx_t, 8> newer_cell_verts;
+            for(int i=0; i<cell_part.size(); i++)
+              newer_cell_verts[i] = new_cell_verts[cell_part[i]];
+            if (add_cell(req_pt_cnt_to_cell_kind(cell_part.size()), cell_verts_span_t(newer_cell_verts.data(), static_cast<std::size_t>(cell_part.size()))))
               num_added++;
           }
         }
         return num_added;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload */
+      inline int add_cell(cell_kind_t new_cell_kind, const cell_verts_t& new_cell_verts, int dimension) {
+        return add_cell(new_cell_kind, cell_verts_span_t(new_cell_verts), dimension);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Add a cell
           @param new_cell_kind   The type of the new cell
           @param new_cell_verts  The vertexes of the new cell
           @return A boolean indicateing success
           @retval true  The cell was added or had been added previously
           @retval false The cell could not be added (because of a failed geometric check) */
-      inline bool add_cell(cell_kind_t new_cell_kind, cell_verts_t new_cell_verts) {
+      inline bool add_cell(cell_kind_t new_cell_kind, const cell_verts_t& new_cell_verts) {
+        return add_cell(new_cell_kind, cell_verts_span_t(new_cell_verts));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload */
+      inline bool add_cell(cell_kind_t new_cell_kind, cell_verts_span_t new_cell_verts) {
         // Check vertexes if required
         if constexpr (chk_cell_vertexes) {
           last_cell_stat = check_cell_vertexes(new_cell_kind, new_cell_verts);
@@ -1287,21 +1882,64 @@ namespace mjr {
         }
         // Geom was good or we didn't need to check.
         if constexpr (chk_cell_unique) {
-          cell_verts_t new_cell_sorted_verts = new_cell_verts;
-          std::sort(new_cell_sorted_verts.begin(), new_cell_sorted_verts.end());
-          if (uniq_cell_lst.contains(new_cell_sorted_verts)) {
+          uniq_cell_key_t new_cell_key;
+          if (uniq_cell_make_key(new_cell_verts, new_cell_key) && !(uniq_cell_insert(new_cell_key))) {
             last_cell_new = false;
           } else {
             last_cell_new = true;
-            cell_lst.push_back(new_cell_verts);
-            uniq_cell_lst.insert(new_cell_sorted_verts);
+            cell_store_push(new_cell_kind, new_cell_verts);
           }
         } else {
-          cell_lst.push_back(new_cell_verts);
+          cell_store_push(new_cell_kind, new_cell_verts);
         }
         return true;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Add several cells of the same kind.
+          Space for all the cells is reserved up front, and then each cell is added exactly as with add_cell().
+          @param new_cell_kind    The type of the new cells
+          @param flat_cell_verts  Vertexes of all the cells, cell_kind_to_req_pt_cnt(new_cell_kind) per cell, one cell after the other
+          @return The status of each cell -- cell_stat_t::GOOD if the cell was added or had been added previously.
+                  Empty if flat_cell_verts.size() is not a multiple of cell_kind_to_req_pt_cnt(new_cell_kind). */
+      std::vector<cell_stat_t> add_cells(cell_kind_t new_cell_kind, cell_verts_span_t flat_cell_verts) {
+        std::vector<cell_stat_t> cell_stats;
+        std::size_t cell_width = static_cast<std::size_t>(cell_kind_to_req_pt_cnt(new_cell_kind));
+        if ((flat_cell_verts.size() % cell_width) != 0) {
+          std::cout << "ERROR(add_cells): Vertex list length is not a multiple of cell size!" << std::endl;
+          return cell_stats;
+        }
+        std::size_t num_new_cells = flat_cell_verts.size() / cell_width;
+        cell_stats.reserve(num_new_cells);
+        cell_store_reserve(num_new_cells, flat_cell_verts.size());
+        for(std::size_t i=0; i<flat_cell_verts.size(); i+=cell_width)
+          cell_stats.push_back(add_cell(new_cell_kind, flat_cell_verts.subspan(i, cell_width)) ? cell_stat_t::GOOD : last_cell_stat);
+        return cell_stats;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload
+          @param new_cell_kinds   The type of each new cell
+          @param flat_cell_verts  Vertexes of all the cells, one cell after the other.  Cell i has cell_kind_to_req_pt_cnt(new_cell_kinds[i]) vertexes.
+          @return The status of each cell.  Empty if the length of flat_cell_verts doesn't match new_cell_kinds. */
+      std::vector<cell_stat_t> add_cells(std::span<const cell_kind_t> new_cell_kinds, cell_verts_span_t flat_cell_verts) {
+        std::vector<cell_stat_t> cell_stats;
+        std::size_t num_verts = 0;
+        for(auto k: new_cell_kinds)
+          num_verts += static_cast<std::size_t>(cell_kind_to_req_pt_cnt(k));
+        if (num_verts != flat_cell_verts.size()) {
+          std::cout << "ERROR(add_cells): Vertex list length does not match cell kinds!" << std::endl;
+          return cell_stats;
+        }
+        cell_stats.reserve(new_cell_kinds.size());
+        cell_store_reserve(new_cell_kinds.size(), flat_cell_verts.size());
+        std::size_t i = 0;
+        for(auto k: new_cell_kinds) {
+          std::size_t cell_width = static_cast<std::size_t>(cell_kind_to_req_pt_cnt(k));
+          cell_stats.push_back(add_cell(k, flat_cell_verts.subspan(i, cell_width)) ? cell_stat_t::GOOD : last_cell_stat);
+          i += cell_width;
+        }
+        return cell_stats;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Retruns the status of the last cell given to the add_cell() method.
           If (chk_cell_vertexes || chk_cell_dimension | chk_cell_edges) is true, this value is updated each time add_cell() is called.
           Otherwise its value is always cell_stat_t::GOOD. */
@@ -1322,15 +1960,220 @@ namespace mjr {
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Type returned by I/O functions */
       typedef int io_result;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Set the number of significant digits used for real numbers in ASCII files.
+
+          The default, 10, matches the historical std::setprecision(10) output.  Zero selects the shortest representation that reads back to exactly the
+          same value (See: std::to_chars).
+
+          @param precision Number of significant digits, or zero for round trip output */
+      void set_ascii_precision(int precision) { ascii_precision = std::max(0, precision); }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Retruns the number of significant digits used for real numbers in ASCII files.  See: set_ascii_precision() */
+      int get_ascii_precision() const { return ascii_precision; }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Append a real number to a string as text.  Same text as std::setprecision(precision) on a stream, or round trip text if precision is zero. */
+      template<typename T>
+      static void append_real(std::string& buf, T v, int precision) {
+        std::array<char, 128> tmp;
+        std::to_chars_result res = (precision > 0 ? std::to_chars(tmp.data(), tmp.data()+tmp.size(), v, std::chars_format::general, precision) :
+                                                    std::to_chars(tmp.data(), tmp.data()+tmp.size(), v));
+        buf.append(tmp.data(), res.ptr);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Append an integer to a string as text. */
+      template<typename T>
+      static void append_int(std::string& buf, T v) {
+        std::array<char, 24> tmp;
+        std::to_chars_result res = std::to_chars(tmp.data(), tmp.data()+tmp.size(), v);
+        buf.append(tmp.data(), res.ptr);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Append the bytes of a value, in native byte order, to a string. */
+      template<typename T>
+      static void append_bin(std::string& buf, T v) {
+        buf.append(reinterpret_cast<const char*>(&v), sizeof(T));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Format items [0, num_items) as text (or binary) on several threads, and write the result to a stream in item order.
+
+          Items are formatted in batches, so only a bounded amount of text is held in memory.  The output does not depend upon the number of threads.
+
+          @param out_stream  Stream to write to
+          @param num_items   Number of items
+          @param num_threads Number of threads to use.  Zero means std::thread::hardware_concurrency().
+          @param fmt_func    Called as fmt_func(buf, item_idx) to append the text for one item to the std::string buf */
+      template<typename func_t>
+      static void write_formatted(std::ostream& out_stream, std::size_t num_items, int num_threads, func_t&& fmt_func) {
+        constexpr std::size_t items_per_thread = 1 << 14;
+        std::size_t max_threads = static_cast<std::size_t>(parallel_for_threads(num_items, num_threads));
+        std::size_t batch_size  = items_per_thread * max_threads;
+        std::vector<std::string> bufs(max_threads);
+        for(std::size_t batch_begin=0; batch_begin<num_items; batch_begin+=batch_size) {
+          std::size_t batch_items = std::min(batch_size, num_items-batch_begin);
+          parallel_for(batch_items, num_threads, [&](std::size_t begin, std::size_t end, int thread_idx) {
+            std::string& buf = bufs[static_cast<std::size_t>(thread_idx)];
+            buf.clear();
+            for(std::size_t i=begin; i<end; i++)
+              fmt_func(buf, batch_begin+i);
+          });
+          for(int thread_idx=0; thread_idx<parallel_for_threads(batch_items, num_threads); thread_idx++)
+            out_stream.write(bufs[static_cast<std::size_t>(thread_idx)].data(), static_cast<std::streamsize>(bufs[static_cast<std::size_t>(thread_idx)].size()));
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Encoding used for the DataArray elements of XML VTK files */
+      enum class xml_encoding_t { ASCII,       //!< Human readable text (format='ascii')
+                                  BASE64,      //!< Inline base64 encoded binary (format='binary')
+                                  RAW,         //!< Raw binary in an AppendedData block at the end of the file (format='appended')
+                                  BASE64_ZLIB, //!< BASE64 with zlib compressed blocks (compressor='vtkZLibDataCompressor').  Requires FUNCVIZ_FOUND_ZLIB.
+                                  RAW_ZLIB     //!< RAW with zlib compressed blocks (compressor='vtkZLibDataCompressor').  Requires FUNCVIZ_FOUND_ZLIB.
+                                };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Uncompressed size of blocks in zlib compressed XML VTK DataArrays */
+      constexpr static std::size_t xml_zlib_block_size = 1 << 15;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Write the base64 encoding of the concatenation of a sequence of byte spans to a stream.
+
+          The spans are encoded as one continuous byte sequence (i.e. no padding between spans).
+
+          @param out_stream Stream to write to
+          @param parts      Byte spans to encode */
+      static void write_base64(std::ostream& out_stream, std::initializer_list<std::span<const unsigned char>> parts) {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::array<char, 4096> out_buf;
+        std::size_t out_len = 0;
+        auto put_triple = [&](const unsigned char* b) {
+          if (out_len+4 > out_buf.size()) {
+            out_stream.write(out_buf.data(), out_len);
+            out_len = 0;
+          }
+          out_buf[out_len++] = alphabet[b[0] >> 2];
+          out_buf[out_len++] = alphabet[((b[0] & 0x03) << 4) | (b[1] >> 4)];
+          out_buf[out_len++] = alphabet[((b[1] & 0x0f) << 2) | (b[2] >> 6)];
+          out_buf[out_len++] = alphabet[b[2] & 0x3f];
+        };
+        std::array<unsigned char, 3> carry = {0, 0, 0};
+        std::size_t carry_len = 0;
+        for(auto& part: parts) {
+          std::size_t i = 0;
+          while ((carry_len > 0) && (carry_len < 3) && (i < part.size()))
+            carry[carry_len++] = part[i++];
+          if (carry_len == 3) {
+            put_triple(carry.data());
+            carry_len = 0;
+          }
+          for(; i+3<=part.size(); i+=3)
+            put_triple(part.data()+i);
+          while (i < part.size())
+            carry[carry_len++] = part[i++];
+        }
+        if (carry_len > 0) {
+          std::fill(carry.begin()+carry_len, carry.end(), 0);
+          put_triple(carry.data());
+          for(std::size_t i=carry_len+1; i<4; i++)
+            out_buf[out_len-4+i] = '=';
+        }
+        out_stream.write(out_buf.data(), out_len);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Fill a byte buffer with count values of type T in native byte order.
+
+          @param buf      Buffer to fill.  It is resized to exactly hold the values.
+          @param count    Number of values
+          @param val_func Function mapping an index in [0, count) to a value */
+      template<typename T, typename F>
+      static void fill_bin_buf(std::vector<unsigned char>& buf, std::size_t count, F val_func) {
+        buf.resize(count*sizeof(T));
+        for(std::size_t i=0; i<count; i++) {
+          T v = static_cast<T>(val_func(i));
+          std::memcpy(buf.data()+i*sizeof(T), &v, sizeof(T));
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Fill a byte buffer with the binary data for one DataArray of an XML VTK file.
+
+          Arrays are numbered in the order they appear in the file: the named datasets (in data_name_to_data_idx_lst order), Points, connectivity, offsets, &
+          types.  Values are in native byte order.
+
+          @param array_idx Index of the array
+          @param buf       Buffer to fill.  It is resized to exactly hold the array. */
+      void xml_vtk_bin_array(std::size_t array_idx, std::vector<unsigned char>& buf) const {
+        std::size_t num_datasets = data_name_to_data_idx_lst.size();
+        std::size_t num_nodes    = static_cast<std::size_t>(node_count());
+        if (array_idx < num_datasets) {
+          const node_data_idx_lst_t& idx_lst = std::next(data_name_to_data_idx_lst.cbegin(), array_idx)->second;
+          std::size_t num_comp = idx_lst.size();
+          fill_bin_buf<double>(buf, num_comp*num_nodes, [&](std::size_t i) { return scalar_from_node(idx_lst[i%num_comp], static_cast<node_idx_t>(i/num_comp)); });
+        } else if (array_idx == num_datasets) {
+          fill_bin_buf<double>(buf, 3*num_nodes, [&](std::size_t i) { return node_idx_to_pnt[i/3][i%3]; });
+        } else if (array_idx == num_datasets+1) {
+          fill_bin_buf<std::int32_t>(buf, cell_conn.size(), [&](std::size_t i) { return cell_conn[i]; });
+        } else if (array_idx == num_datasets+2) {
+          fill_bin_buf<std::int32_t>(buf, cell_kinds.size(), [&](std::size_t i) { return cell_offsets[i+1]; });
+        } else {
+          fill_bin_buf<std::int8_t>(buf, cell_kinds.size(), [&](std::size_t i) { return cell_kind_to_vtk_type(cell_kinds[i]); });
+        }
+      }
+#if FUNCVIZ_FOUND_ZLIB
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Compress a DataArray in the vtkZLibDataCompressor block format.
+
+          The buffer is split into xml_zlib_block_size blocks that are compressed independently (in parallel).  The header is
+          [number of blocks, block size, size of last block (0 if full), compressed size of each block] -- all UInt64.
+
+          @param buf         Uncompressed data
+          @param header      Filled with the compression header
+          @param comp_buf    Filled with the compressed blocks, one after the other
+          @param zlib_level  zlib compression level: 0 (none) to 9 (best), or -1 for the zlib default
+          @param num_threads Number of threads to use.  Zero means std::thread::hardware_concurrency().
+          @return true if everything worked */
+      static bool xml_vtk_zlib_array(const std::vector<unsigned char>& buf, std::vector<std::uint64_t>& header, std::vector<unsigned char>& comp_buf,
+                                     int zlib_level, int num_threads) {
+        std::size_t num_blocks = (buf.size() + xml_zlib_block_size - 1) / xml_zlib_block_size;
+        std::vector<std::vector<unsigned char>> blocks(num_blocks);
+        std::vector<int> block_ok(num_blocks, 0);
+        parallel_for(num_blocks, num_threads, [&](std::size_t begin, std::size_t end, int) {
+          for(std::size_t i=begin; i<end; i++) {
+            std::size_t src_len  = std::min(xml_zlib_block_size, buf.size() - i*xml_zlib_block_size);
+            uLongf      dest_len = compressBound(static_cast<uLong>(src_len));
+            blocks[i].resize(dest_len);
+            block_ok[i] = (compress2(blocks[i].data(), &dest_len, buf.data()+i*xml_zlib_block_size, static_cast<uLong>(src_len), zlib_level) == Z_OK);
+            blocks[i].resize(dest_len);
+          }
+        });
+        header.clear();
+        header.push_back(num_blocks);
+        header.push_back(xml_zlib_block_size);
+        header.push_back(buf.size() % xml_zlib_block_size);
+        comp_buf.clear();
+        for(std::size_t i=0; i<num_blocks; i++) {
+          if ( !(block_ok[i]))
+            return false;
+          header.push_back(blocks[i].size());
+          comp_buf.insert(comp_buf.end(), blocks[i].begin(), blocks[i].end());
+        }
+        return true;
+      }
+#endif
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Dump to an XML VTK unstructured grid file
 
           Note: A point vector data set named "NORMALS" will be used for normal vectors.
 
+          Binary files use a UInt64 header_type, and are written in native byte order.  With xml_encoding_t::RAW the arrays are placed, in order, in a single
+          AppendedData block at the end of the file.  The zlib encodings compress each array in xml_zlib_block_size blocks on num_threads threads, and
+          return 4 when zlib support was not compiled in (See: FUNCVIZ_FOUND_ZLIB).  If compression fails, then the partly written file is removed & 4 is
+          returned.
+
           @param file_name   The name of the output file
           @param description This is included as a file comment at the start of the file.
+          @param encoding    Encoding for DataArray elements
+          @param zlib_level  zlib compression level: 0 (none) to 9 (best), or -1 for the zlib default.  Only used by the zlib encodings.
+          @param num_threads Number of threads used for ASCII formatting & compression.  Zero means std::thread::hardware_concurrency().
           @return 0 if everything worked, and non-zero otherwise */
-      io_result write_xml_vtk(std::string file_name, std::string description) {
+      io_result write_xml_vtk(std::string file_name, std::string description, xml_encoding_t encoding = xml_encoding_t::ASCII,
+                              [[maybe_unused]] int zlib_level = -1, int num_threads = 1) {
         /* Check that we have data */
         if (node_count() <= 0) {
           std::cout << "ERROR(write_xml_vtk): No points!" << std::endl;
@@ -1340,6 +2183,13 @@ namespace mjr {
           std::cout << "ERROR(write_xml_vtk): No cells!" << std::endl;
           return 2;
         }
+        bool zlib = ((encoding == xml_encoding_t::BASE64_ZLIB) || (encoding == xml_encoding_t::RAW_ZLIB));
+#if !(FUNCVIZ_FOUND_ZLIB)
+        if (zlib) {
+          std::cout << "ERROR(write_xml_vtk): zlib support not available!" << std::endl;
+          return 4;
+        }
+#endif
         /* Looks like we have data.  Let's open our file */
         std::ofstream out_stream;
         out_stream.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
@@ -1349,7 +2199,51 @@ namespace mjr {
           std::cout << "ERROR(write_xml_vtk): Could not open file!" << std::endl;
           return 3;
         }
-        out_stream << "<VTKFile type='UnstructuredGrid' version='0.1' byte_order='LittleEndian'>" << std::endl;
+        /* Binary DataArray elements.  The attributes passed should not include format. */
+        bool                                    ascii           = (encoding == xml_encoding_t::ASCII);
+        bool                                    appended        = ((encoding == xml_encoding_t::RAW) || (encoding == xml_encoding_t::RAW_ZLIB));
+        std::size_t                             num_bin_arrays  = 0;
+        std::uint64_t                           appended_offset = 0;
+        std::vector<std::vector<unsigned char>> appended_zlib;
+        std::vector<unsigned char>              bin_buf;
+        std::vector<std::uint64_t>              zlib_header;
+        std::vector<unsigned char>              zlib_buf;
+        auto as_bytes = [](const auto& vec) { return std::span<const unsigned char>(reinterpret_cast<const unsigned char*>(vec.data()), vec.size()*sizeof(vec[0])); };
+        auto put_bin_array = [&](std::string attrs) {
+          xml_vtk_bin_array(num_bin_arrays++, bin_buf);
+          std::array<std::uint64_t, 1> num_bytes = {bin_buf.size()};
+#if FUNCVIZ_FOUND_ZLIB
+          if (zlib && !(xml_vtk_zlib_array(bin_buf, zlib_header, zlib_buf, zlib_level, num_threads)))
+            return false;
+#endif
+          if (appended) {
+            out_stream << "        <DataArray " << attrs << " format='appended' offset='" << appended_offset << "'/>" << std::endl;
+            if (zlib) {
+              appended_zlib.emplace_back(as_bytes(zlib_header).begin(), as_bytes(zlib_header).end());
+              appended_zlib.back().insert(appended_zlib.back().end(), zlib_buf.begin(), zlib_buf.end());
+              appended_offset += appended_zlib.back().size();
+            } else {
+              appended_offset += sizeof(std::uint64_t) + bin_buf.size();
+            }
+          } else {
+            out_stream << "        <DataArray " << attrs << " format='binary'>" << std::endl;
+            out_stream << "          ";
+            if (zlib) {
+              write_base64(out_stream, {as_bytes(zlib_header)});
+              write_base64(out_stream, {as_bytes(zlib_buf)});
+            } else {
+              write_base64(out_stream, {as_bytes(num_bytes), as_bytes(bin_buf)});
+            }
+            out_stream << std::endl << "        </DataArray>" << std::endl;
+          }
+          return true;
+        };
+        bool bin_ok = true;
+        if (ascii)
+          out_stream << "<VTKFile type='UnstructuredGrid' version='0.1' byte_order='LittleEndian'>" << std::endl;
+        else
+          out_stream << "<VTKFile type='UnstructuredGrid' version='1.0' byte_order='" << (std::endian::native == std::endian::big ? "BigEndian" : "LittleEndian")
+                     << "' header_type='UInt64'" << (zlib ? " compressor='vtkZLibDataCompressor'" : "") << ">" << std::endl;
         out_stream << "<!-- " << description << " -->" << std::endl;
         out_stream << "  <UnstructuredGrid>" << std::endl;
         out_stream << "    <Piece NumberOfPoints='" << node_count() << "' NumberOfCells='" << num_cells() << "'>" << std::endl;
@@ -1372,68 +2266,149 @@ namespace mjr {
             out_stream << " Vectors='" << vectors_attr_value << "'";
           out_stream << ">" << std::endl;
           for (auto& kv : data_name_to_data_idx_lst) {
-            out_stream << "        <DataArray Name='" << kv.first << "' type='Float64' format='ascii' NumberOfComponents='" << kv.second.size() << "'>" << std::endl;
-            out_stream << "          ";
-            for (const auto& dv : node_idx_to_node_data) {
-              for (auto& idx : kv.second)
-                out_stream << std::setprecision(10) << scalar_from_node_data(idx, dv) << " ";
+            if (ascii) {
+              out_stream << "        <DataArray Name='" << kv.first << "' type='Float64' format='ascii' NumberOfComponents='" << kv.second.size() << "'>" << std::endl;
+              out_stream << "          ";
+              write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+                for (auto& idx : kv.second) {
+                  append_real(buf, scalar_from_node(idx, static_cast<node_idx_t>(pnt_idx)), ascii_precision);
+                  buf += ' ';
+                }
+              });
+              out_stream << std::endl << "        </DataArray>" << std::endl;
+            } else {
+              bin_ok = bin_ok && put_bin_array("Name='" + kv.first + "' type='Float64' NumberOfComponents='" + std::to_string(kv.second.size()) + "'");
             }
-            out_stream << std::endl << "        </DataArray>" << std::endl;
           }
           out_stream << "      </PointData>" << std::endl;
         }
         out_stream << "      <Points>" << std::endl;
-        out_stream << "        <DataArray Name='Points' type='Float64' format='ascii' NumberOfComponents='3'>" << std::endl;
-        for(node_idx_t pnt_idx=0; pnt_idx<static_cast<node_idx_t>(node_idx_to_node_data.size()); pnt_idx++) {
-          fvec3_t pnt = get_pnt(pnt_idx);
-          out_stream << "          " << std::setprecision(10) << pnt[0] << " " << pnt[1] << " " << pnt[2] << std::endl;
+        if (ascii) {
+          out_stream << "        <DataArray Name='Points' type='Float64' format='ascii' NumberOfComponents='3'>" << std::endl;
+          write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+            const fvec3_t& pnt = get_pnt(static_cast<node_idx_t>(pnt_idx));
+            buf += "          ";
+            for(int i=0; i<3; i++) {
+              append_real(buf, pnt[i], ascii_precision);
+              buf += (i < 2 ? ' ' : '\n');
+            }
+          });
+          out_stream << "        </DataArray>" << std::endl;
+        } else {
+          bin_ok = bin_ok && put_bin_array("Name='Points' type='Float64' NumberOfComponents='3'");
         }
-        out_stream << "        </DataArray>" << std::endl;
         out_stream << "      </Points>" << std::endl;
         out_stream << "      <Cells>" << std::endl;
-        out_stream << "        <DataArray type='Int32' Name='connectivity' format='ascii'>" << std::endl;
-        for(auto& poly: cell_lst) {
-          out_stream << "          " ;
-          for(auto& vert: poly)
-            out_stream << vert << " ";
+        if (ascii) {
+          out_stream << "        <DataArray type='Int32' Name='connectivity' format='ascii'>" << std::endl;
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            buf += "          ";
+            for(auto& vert: get_cell_verts(static_cast<int>(cell_idx))) {
+              append_int(buf, vert);
+              buf += ' ';
+            }
+            buf += '\n';
+          });
+          out_stream << "        </DataArray>" << std::endl;
+          out_stream << "        <DataArray type='Int32' Name='offsets' format='ascii'>" << std::endl;
+          out_stream << "          ";
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            append_int(buf, cell_offsets[cell_idx+1]);
+            buf += ' ';
+          });
           out_stream << std::endl;
+          out_stream << "        </DataArray>" << std::endl;
+          out_stream << "        <DataArray type='Int8' Name='types' format='ascii'>" << std::endl;
+          out_stream << "          ";
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            append_int(buf, cell_kind_to_vtk_type(cell_kinds[cell_idx]));
+            buf += ' ';
+          });
+          out_stream << std::endl;
+          out_stream << "        </DataArray>" << std::endl;
+        } else {
+          bin_ok = bin_ok && put_bin_array("type='Int32' Name='connectivity'");
+          bin_ok = bin_ok && put_bin_array("type='Int32' Name='offsets'");
+          bin_ok = bin_ok && put_bin_array("type='Int8' Name='types'");
         }
-        out_stream << "        </DataArray>" << std::endl;
-        out_stream << "        <DataArray type='Int32' Name='offsets' format='ascii'>" << std::endl;
-        out_stream << "          ";
-        std::vector<int>::size_type j = 0;
-        for(auto& poly: cell_lst) {
-          j += poly.size();
-          out_stream << j << " ";
-        }
-        out_stream << std::endl;
-        out_stream << "        </DataArray>" << std::endl;
-        out_stream << "        <DataArray type='Int8' Name='types' format='ascii'>" << std::endl;
-        out_stream << "          ";
-        for(auto& poly: cell_lst)
-          out_stream << cell_kind_to_vtk_type(req_pt_cnt_to_cell_kind(poly.size())) << " ";
-        out_stream << std::endl;
-        out_stream << "        </DataArray>" << std::endl;
         out_stream << "      </Cells>" << std::endl;
         out_stream << "    </Piece>" << std::endl;
         out_stream << "  </UnstructuredGrid>" << std::endl;
+        if (appended) {
+          out_stream << "  <AppendedData encoding='raw'>" << std::endl;
+          out_stream << "   _";
+          if (zlib) {
+            for(auto& zlib_array: appended_zlib)
+              out_stream.write(reinterpret_cast<const char*>(zlib_array.data()), static_cast<std::streamsize>(zlib_array.size()));
+          } else {
+            for(std::size_t i=0; i<num_bin_arrays; i++) {
+              xml_vtk_bin_array(i, bin_buf);
+              std::uint64_t num_bytes = bin_buf.size();
+              out_stream.write(reinterpret_cast<const char*>(&num_bytes), sizeof(num_bytes));
+              out_stream.write(reinterpret_cast<const char*>(bin_buf.data()), static_cast<std::streamsize>(num_bytes));
+            }
+          }
+          out_stream << std::endl << "  </AppendedData>" << std::endl;
+        }
         out_stream << "</VTKFile>" << std::endl;
 
         /* Final newline */
         out_stream << std::endl;
         out_stream.close();
+        if ( !(bin_ok)) {
+          std::cout << "ERROR(write_xml_vtk): zlib compression failed!" << std::endl;
+          std::remove(file_name.c_str());
+          return 4;
+        }
         return 0;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Encoding used for legacy VTK files */
+      enum class legacy_encoding_t { ASCII,  //!< Human readable text (ASCII)
+                                     BINARY  //!< Big endian binary (BINARY)
+                                   };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Write values to a stream as big endian binary (legacy VTK byte order).
+
+          Values are converted to T in batches (on several threads), and each batch is byte swapped as a single array on little endian hosts.
+
+          @param out_stream  Stream to write to
+          @param count       Number of values
+          @param num_threads Number of threads to use.  Zero means std::thread::hardware_concurrency().
+          @param val_func    Function mapping an index in [0, count) to a value */
+      template<typename T, typename func_t>
+      static void write_big_endian(std::ostream& out_stream, std::size_t count, int num_threads, func_t&& val_func) {
+        typedef std::conditional_t<sizeof(T)==8, std::uint64_t, std::conditional_t<sizeof(T)==4, std::uint32_t, std::uint8_t>> bits_t;
+        static_assert(sizeof(bits_t) == sizeof(T), "write_big_endian: Unsupported type size");
+        constexpr std::size_t batch_size = 1 << 16;
+        std::vector<bits_t> buf(std::min(count, batch_size));
+        for(std::size_t batch_begin=0; batch_begin<count; batch_begin+=batch_size) {
+          std::size_t batch_items = std::min(batch_size, count-batch_begin);
+          parallel_for(batch_items, num_threads, [&](std::size_t begin, std::size_t end, int) {
+            for(std::size_t i=begin; i<end; i++)
+              buf[i] = std::bit_cast<bits_t>(static_cast<T>(val_func(batch_begin+i)));
+          });
+          if constexpr ((std::endian::native == std::endian::little) && (sizeof(T) > 1))
+            for(std::size_t i=0; i<batch_items; i++)
+              buf[i] = std::byteswap(buf[i]);
+          out_stream.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(batch_items*sizeof(bits_t)));
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Dump to a legacy VTK UNSTRUCTUREDGRID file.
 
           Note: A point vector data set named "NORMALS" will be used for normal vectors.
           Note: A point vector data set named "COLORS" will be used as COLOR_SCALARS.  Components should be in [0.0, 1.0].
 
+          Binary files hold big endian doubles & int32s as the legacy format requires, and NaN values survive the trip.  In binary files COLOR_SCALARS are
+          unsigned chars (components are scaled to [0, 255] and clamped).
+
           @param file_name   The name of the output file
           @param description This is the file description.
+          @param encoding    Text or binary
+          @param num_threads Number of threads used for formatting.  Zero means std::thread::hardware_concurrency().
           @return 0 if everything worked, and non-zero otherwise */
-      io_result write_legacy_vtk(std::string file_name, std::string description) {
+      io_result write_legacy_vtk(std::string file_name, std::string description, legacy_encoding_t encoding = legacy_encoding_t::ASCII, int num_threads = 1) {
         /* Check that we have data */
         if (node_count() <= 0) {
           std::cout << "ERROR(write_legacy_vtk): No points!" << std::endl;
@@ -1452,33 +2427,60 @@ namespace mjr {
           std::cout << "ERROR(write_legacy_vtk): Could not open file!" << std::endl;
           return 3;
         }
+        bool binary = (encoding == legacy_encoding_t::BINARY);
         /* Dump the header */
         out_stream << "# vtk DataFile Version 3.0" << std::endl;
         out_stream << description << std::endl;
-        out_stream << "ASCII" << std::endl;
+        out_stream << (binary ? "BINARY" : "ASCII") << std::endl;
         out_stream << "DATASET UNSTRUCTURED_GRID" << std::endl;
         /* Dump the points */
         out_stream << "POINTS " << node_count() << " double" << std::endl;
-        //for (const auto& pnt : node_idx_to_pnt)
-        for(node_idx_t pnt_idx=0; pnt_idx<static_cast<node_idx_t>(node_idx_to_node_data.size()); pnt_idx++) {
-          fvec3_t pnt = get_pnt(pnt_idx);
-          out_stream << std::setprecision(10) << pnt[0] << " " << pnt[1] << " " << pnt[2] << std::endl;
+        if (binary) {
+          write_big_endian<double>(out_stream, 3*node_idx_to_pnt.size(), num_threads, [&](std::size_t i) { return node_idx_to_pnt[i/3][i%3]; });
+          out_stream << std::endl;
+        } else {
+          write_formatted(out_stream, node_idx_to_pnt.size(), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+            for(int i=0; i<3; i++) {
+              append_real(buf, node_idx_to_pnt[pnt_idx][i], ascii_precision);
+              buf += (i < 2 ? ' ' : '\n');
+            }
+          });
         }
         /* Dump the cell data */
-        std::vector<int>::size_type total_cells_ints = 0;
-        for(auto& cell: cell_lst)
-          total_cells_ints += (1+cell.size());
+        std::vector<int>::size_type total_cells_ints = cell_kinds.size() + cell_conn.size();
         out_stream << "CELLS " << num_cells() << " " << total_cells_ints << std::endl;
-        for(auto& poly: cell_lst) {
-          out_stream << poly.size() << " ";
-          for(auto& vert: poly) {
-            out_stream << vert << " ";
+        if (binary) {
+          std::vector<std::int32_t> cells_ints;
+          cells_ints.reserve(total_cells_ints);
+          for(int cell_idx=0; cell_idx<num_cells(); cell_idx++) {
+            cell_verts_span_t poly = get_cell_verts(cell_idx);
+            cells_ints.push_back(static_cast<std::int32_t>(poly.size()));
+            cells_ints.insert(cells_ints.end(), poly.begin(), poly.end());
           }
+          write_big_endian<std::int32_t>(out_stream, cells_ints.size(), num_threads, [&](std::size_t i) { return cells_ints[i]; });
+          out_stream << std::endl;
+        } else {
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            cell_verts_span_t poly = get_cell_verts(static_cast<int>(cell_idx));
+            append_int(buf, poly.size());
+            buf += ' ';
+            for(auto& vert: poly) {
+              append_int(buf, vert);
+              buf += ' ';
+            }
+            buf += '\n';
+          });
+        }
+        out_stream << "CELL_TYPES " << num_cells() << std::endl;
+        if (binary) {
+          write_big_endian<std::int32_t>(out_stream, cell_kinds.size(), num_threads, [&](std::size_t i) { return cell_kind_to_vtk_type(cell_kinds[i]); });
           out_stream << std::endl;
+        } else {
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            append_int(buf, cell_kind_to_vtk_type(cell_kinds[cell_idx]));
+            buf += '\n';
+          });
         }
-        out_stream << "CELL_KINDS " << num_cells() << std::endl;
-        for(auto& poly: cell_lst)
-          out_stream << cell_kind_to_vtk_type(req_pt_cnt_to_cell_kind(poly.size())) << std::endl;
         /* Dump point scalar data */
         if (data_name_to_data_idx_lst.size() > 0) {
           out_stream << "POINT_DATA " << node_count() << std::endl;
@@ -1487,9 +2489,16 @@ namespace mjr {
               if (kv.second.size() == 1) {
                 out_stream << "SCALARS " << kv.first << " double 1" << std::endl;
                 out_stream << "LOOKUP_TABLE default" << std::endl;
-                for (const auto& dv : node_idx_to_node_data) {
-                  uft_t v = scalar_from_node_data(kv.second[0], dv);
-                  out_stream << std::setprecision(10) << v << std::endl;
+                if (binary) {
+                  write_big_endian<double>(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::size_t pnt_idx) {
+                    return scalar_from_node(kv.second[0], static_cast<node_idx_t>(pnt_idx));
+                  });
+                  out_stream << std::endl;
+                } else {
+                  write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+                    append_real(buf, scalar_from_node(kv.second[0], static_cast<node_idx_t>(pnt_idx)), ascii_precision);
+                    buf += '\n';
+                  });
                 }
               }
             }
@@ -1504,9 +2513,26 @@ namespace mjr {
                 } else {
                   out_stream << "VECTORS " << kv.first << " double" << std::endl; 
                 }
-                for (const auto& dv : node_idx_to_node_data) {
-                  vdat_t v = vector_from_node_data(kv.second, dv);
-                  out_stream << std::setprecision(10) << v[0] << " " << v[1] << " " << v[2] << std::endl;
+                if (binary) {
+                  if ("COLORS" == kv.first) {
+                    write_big_endian<std::uint8_t>(out_stream, 3*static_cast<std::size_t>(node_count()), num_threads, [&](std::size_t i) {
+                      uft_t c = scalar_from_node(kv.second[i%3], static_cast<node_idx_t>(i/3));
+                      return (c > 0 ? (c < 1 ? 255*c : 255) : 0);
+                    });
+                  } else {
+                    write_big_endian<double>(out_stream, 3*static_cast<std::size_t>(node_count()), num_threads, [&](std::size_t i) {
+                      return scalar_from_node(kv.second[i%3], static_cast<node_idx_t>(i/3));
+                    });
+                  }
+                  out_stream << std::endl;
+                } else {
+                  write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+                    fvec3_t v = fvec3_from_node(kv.second, static_cast<node_idx_t>(pnt_idx));
+                    for(int i=0; i<3; i++) {
+                      append_real(buf, v[i], ascii_precision);
+                      buf += (i < 2 ? ' ' : '\n');
+                    }
+                  });
                 }
               }
             }
@@ -1524,7 +2550,7 @@ namespace mjr {
       void dump_cplx(int max_num_print) const {
         std::cout << "Meta Data" << std::endl;
         std::cout << "  Points .................. " << node_count() << std::endl;
-        std::cout << "  Data Scalars Per Point .. " << node_idx_to_node_data.size() << std::endl;
+        std::cout << "  Data Scalars Per Point .. " << node_count() << std::endl;
         std::cout << "  Named Data Sets ......... " << named_datasets_count() << std::endl;
         std::cout << "    Scalar Data Sets ...... " << named_scalar_datasets_count() << std::endl;
         std::cout << "    Vector Data Sets ...... " << named_vector_datasets_count() << std::endl;
@@ -1547,9 +2573,9 @@ namespace mjr {
           std::cout << "CELLS BEGIN (" << num_cells() << ")" << std::endl;
           for(int i=0; i<num_cells(); i++) {
             std::cout << "  ";
-            for(auto& vert: cell_lst[i]) 
+            for(auto& vert: get_cell_verts(i)) 
               std::cout << vert << " ";
-            std::cout << "   " << cell_kind_to_string(req_pt_cnt_to_cell_kind(cell_lst[i].size())) << std::endl;
+            std::cout << "   " << cell_kind_to_string(get_cell_kind(i)) << std::endl;
             num_cells_printed++;
             if ((max_num_print > 0) && (num_cells_printed >= max_num_print)) {
               std::cout << "  Maximum number of cells reached.  Halting tree dump." << std::endl;
@@ -1560,15 +2586,25 @@ namespace mjr {
         }
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Encoding used for PLY files */
+      enum class ply_encoding_t { ASCII,          //!< Human readable text (format ascii)
+                                  BINARY_FLOAT32, //!< Binary with float vertex properties (format binary_little_endian on little endian hosts)
+                                  BINARY_FLOAT64  //!< Binary with double vertex properties (format binary_little_endian on little endian hosts)
+                                };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Dump to a PLY file
 
           Note: If one of the point vector data sets is named "NORMALS", then it will be used for normal vectors.
           Note: If one of the point vector data sets is named "COLORS", then it will be used for color data.  Components should be in [0.0, 1.0].
 
+          Binary files are written in native byte order with uchar colors and uchar/int face lists.  Colors are clamped to [0, 255] in binary files.
+
           @param file_name   The name of the output file
           @param description For legacy files, this is the file description.  For XML files this is included as a file comment at the start of the file.
+          @param encoding    Text or binary, and the real type used for vertex properties in binary files
+          @param num_threads Number of threads used for formatting.  Zero means std::thread::hardware_concurrency().
           @return 0 if everything worked, and non-zero otherwise */
-      io_result write_ply(std::string file_name, std::string description) {
+      io_result write_ply(std::string file_name, std::string description, ply_encoding_t encoding = ply_encoding_t::ASCII, int num_threads = 1) {
         /* Check that we have data */
         if (node_count() <= 0) {
           std::cout << "ERROR(write_ply): No points!" << std::endl;
@@ -1578,8 +2614,7 @@ namespace mjr {
           std::cout << "ERROR(write_ply): No cells!" << std::endl;
           return 2;
         }
-        for(auto& poly: cell_lst) {
-          cell_kind_t cell_kind = req_pt_cnt_to_cell_kind(poly.size());
+        for(auto cell_kind: cell_kinds) {
           if ( !((cell_kind == cell_kind_t::TRIANGLE) || (cell_kind == cell_kind_t::QUAD))) {
             std::cout << "ERROR(write_ply): Cells must all be 2D (triangles or quads)!" << std::endl;
             return 2;
@@ -1596,55 +2631,449 @@ namespace mjr {
         }
         bool have_colors_data = data_name_to_data_idx_lst.contains("COLORS");
         bool have_normal_data = data_name_to_data_idx_lst.contains("NORMALS");
+        std::string real_type = (encoding == ply_encoding_t::BINARY_FLOAT64 ? "double" : "float");
         out_stream << "ply" << std::endl;
-        out_stream << "format ascii 1.0" << std::endl;
+        if (encoding == ply_encoding_t::ASCII)
+          out_stream << "format ascii 1.0" << std::endl;
+        else
+          out_stream << "format " << (std::endian::native == std::endian::big ? "binary_big_endian" : "binary_little_endian") << " 1.0" << std::endl;
         out_stream << "comment software: Mitch Richling's MR_rect_tree package" << std::endl;
         out_stream << "comment note: " << description << std::endl;
         out_stream << "element vertex " << node_count() << std::endl;
-        out_stream << "property float x" << std::endl;
-        out_stream << "property float y" << std::endl;
-        out_stream << "property float z" << std::endl;
+        out_stream << "property " << real_type << " x" << std::endl;
+        out_stream << "property " << real_type << " y" << std::endl;
+        out_stream << "property " << real_type << " z" << std::endl;
         if (have_colors_data) {
           out_stream << "property uchar red" << std::endl;
           out_stream << "property uchar green" << std::endl;
           out_stream << "property uchar blue" << std::endl;
         }
         if (have_normal_data) {
-          out_stream << "property float nx" << std::endl;
-          out_stream << "property float ny" << std::endl;
-          out_stream << "property float nz" << std::endl;
+          out_stream << "property " << real_type << " nx" << std::endl;
+          out_stream << "property " << real_type << " ny" << std::endl;
+          out_stream << "property " << real_type << " nz" << std::endl;
         }
         out_stream << "element face " << num_cells() << std::endl; // May need to be adjusted if cells are not triangles..
         out_stream << "property list uchar int vertex_index" << std::endl;
         out_stream << "end_header" << std::endl;
-        // Dump Vertex Data
-        for (int i=0; i<node_count(); i++) {
-          fvec3_t pnt = get_pnt(i);
-          out_stream << std::setprecision(10) << pnt[0] << " " << pnt[1] << " " << pnt[2];
-          if (have_colors_data) {
-            fvec3_t clr = fvec3_from_node_data(data_name_to_data_idx_lst["COLORS"], node_idx_to_node_data[i]);
-            out_stream << " " << static_cast<int>(255*clr[0]) << " " << static_cast<int>(255*clr[1]) << " " << static_cast<int>(255*clr[2]);
-          }
-          if (have_normal_data) {
-            fvec3_t nml = fvec3_from_node_data(data_name_to_data_idx_lst["NORMALS"], node_idx_to_node_data[i]);
-            vec3_unitize(nml);
-            out_stream << " " << std::setprecision(10) << nml[0] << " " << nml[1] << " " << nml[2];
-          }
-          out_stream << std::endl;
-        }
-        // Dump Cells
-        for(auto& poly: cell_lst) {
-          out_stream << poly.size() << " ";
-          for(auto& vert: poly) {
-            out_stream << vert << " ";
-          }
+        const node_data_idx_lst_t* colors_idx_lst = (have_colors_data ? &data_name_to_data_idx_lst["COLORS"]  : nullptr);
+        const node_data_idx_lst_t* normal_idx_lst = (have_normal_data ? &data_name_to_data_idx_lst["NORMALS"] : nullptr);
+        if (encoding == ply_encoding_t::ASCII) {
+          // Dump Vertex Data
+          write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+            const fvec3_t& pnt = get_pnt(static_cast<node_idx_t>(pnt_idx));
+            for(int i=0; i<3; i++) {
+              if (i > 0)
+                buf += ' ';
+              append_real(buf, pnt[i], ascii_precision);
+            }
+            if (have_colors_data) {
+              fvec3_t clr = fvec3_from_node(*colors_idx_lst, static_cast<node_idx_t>(pnt_idx));
+              for(int i=0; i<3; i++) {
+                buf += ' ';
+                append_int(buf, static_cast<int>(255*clr[i]));
+              }
+            }
+            if (have_normal_data) {
+              fvec3_t nml = fvec3_from_node(*normal_idx_lst, static_cast<node_idx_t>(pnt_idx));
+              vec3_unitize(nml);
+              for(int i=0; i<3; i++) {
+                buf += ' ';
+                append_real(buf, nml[i], ascii_precision);
+              }
+            }
+            buf += '\n';
+          });
+          // Dump Cells
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            cell_verts_span_t poly = get_cell_verts(static_cast<int>(cell_idx));
+            append_int(buf, poly.size());
+            buf += ' ';
+            for(auto& vert: poly) {
+              append_int(buf, vert);
+              buf += ' ';
+            }
+            buf += '\n';
+          });
+          /* Final newline */
           out_stream << std::endl;
+        } else {
+          auto append_real_bin = [encoding](std::string& buf, uft_t v) {
+            if (encoding == ply_encoding_t::BINARY_FLOAT64)
+              append_bin(buf, static_cast<double>(v));
+            else
+              append_bin(buf, static_cast<float>(v));
+          };
+          // Dump Vertex Data
+          write_formatted(out_stream, static_cast<std::size_t>(node_count()), num_threads, [&](std::string& buf, std::size_t pnt_idx) {
+            const fvec3_t& pnt = get_pnt(static_cast<node_idx_t>(pnt_idx));
+            for(int i=0; i<3; i++)
+              append_real_bin(buf, pnt[i]);
+            if (have_colors_data) {
+              fvec3_t clr = fvec3_from_node(*colors_idx_lst, static_cast<node_idx_t>(pnt_idx));
+              for(int i=0; i<3; i++)
+                append_bin(buf, static_cast<std::uint8_t>(clr[i] > 0 ? (clr[i] < 1 ? 255*clr[i] : 255) : 0));
+            }
+            if (have_normal_data) {
+              fvec3_t nml = fvec3_from_node(*normal_idx_lst, static_cast<node_idx_t>(pnt_idx));
+              vec3_unitize(nml);
+              for(int i=0; i<3; i++)
+                append_real_bin(buf, nml[i]);
+            }
+          });
+          // Dump Cells
+          write_formatted(out_stream, cell_kinds.size(), num_threads, [&](std::string& buf, std::size_t cell_idx) {
+            cell_verts_span_t poly = get_cell_verts(static_cast<int>(cell_idx));
+            append_bin(buf, static_cast<std::uint8_t>(poly.size()));
+            for(auto& vert: poly)
+              append_bin(buf, static_cast<std::int32_t>(vert));
+          });
         }
-        /* Final newline */
-        out_stream << std::endl;
         out_stream.close();
         return 0;
       }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** File formats supported by stream_writer_t */
+      enum class stream_format_t { XML_VTK, //!< Same as write_xml_vtk()
+                                   PLY,     //!< Same as write_ply()
+                                 };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Write a geometry file one node & one cell at a time -- the complex is never held in memory.
+
+          Nodes are taken from any MR_cell_cplx object of this type (normally small batches), and given consecutive indexes in the file.  Cells are given in
+          terms of these file node indexes.  Each section of the file is written to a temporary file next to the output file, and the sections are
+          assembled by close().  The result is the same as the corresponding write_*() method on a complex holding the same nodes & cells.
+
+          Named datasets are given to open(), and are evaluated on each node as it is added.  For PLY files all cells must be 2D.
+
+          Text is formatted with append_real() & append_int(), and each section is buffered in memory part_buf_size bytes at a time.  Real numbers use
+          the precision of the writer (See: set_ascii_precision()), not the precision of the complexes the nodes are taken from. */
+      class stream_writer_t {
+        public:
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Close the file if it is still open. */
+          ~stream_writer_t() {
+            if (is_open())
+              close();
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Start a new file.
+              @param file_name    The name of the output file
+              @param description  Included in the file as with the write_*() methods
+              @param format       File format
+              @param data_names   Named datasets to write (See: create_named_datasets() & set_data_name_to_data_idx_lst())
+              @return 0 if everything worked, and non-zero otherwise */
+          io_result open(std::string file_name, std::string description, stream_format_t format, data_name_to_node_data_idx_lst_t data_names = {}) {
+            if (is_open()) {
+              std::cout << "ERROR(stream_writer_t::open): Writer already open!" << std::endl;
+              return 4;
+            }
+            out_file_name = file_name;
+            out_description = description;
+            out_format = format;
+            out_data_names = data_names;
+            out_node_count = 0;
+            out_cell_count = 0;
+            out_conn_count = 0;
+            out_bad_cell = false;
+            int num_parts = (out_format == stream_format_t::XML_VTK ? static_cast<int>(out_data_names.size()) + 4 : 2);
+            part_streams.clear();
+            part_streams.resize(static_cast<std::size_t>(num_parts));
+            part_bufs.assign(static_cast<std::size_t>(num_parts), std::string());
+            for(int i=0; i<num_parts; ++i) {
+              part_streams[i].open(part_file_name(i), std::ios::out | std::ios::binary | std::ios::trunc);
+              if (part_streams[i].is_open()) {
+                part_bufs[i].reserve(part_buf_size);
+              } else {
+                std::cout << "ERROR(stream_writer_t::open): Could not open temporary file!" << std::endl;
+                part_streams.resize(static_cast<std::size_t>(i+1));
+                discard_parts();
+                return 3;
+              }
+            }
+            return 0;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Retruns true if open() has been called, and close() has not. */
+          bool is_open() const {
+            return !(part_streams.empty());
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Set the number of significant digits used for real numbers.  Zero means the shortest text that reads back to the same value.
+              See: MR_cell_cplx::set_ascii_precision() */
+          void set_ascii_precision(int precision) { out_precision = std::max(0, precision); }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Retruns the number of significant digits used for real numbers.  See: set_ascii_precision() */
+          int get_ascii_precision() const { return out_precision; }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Write a node from a complex, and return its index in the file.
+              @param ccplx    Complex holding the node
+              @param pnt_idx  Index of the node in ccplx */
+          node_idx_t add_node(const MR_cell_cplx& ccplx, node_idx_t pnt_idx) {
+            const fvec3_t& pnt = ccplx.get_pnt(pnt_idx);
+            if (out_format == stream_format_t::XML_VTK) {
+              int part = 0;
+              for (auto& kv : out_data_names) {
+                for (auto& idx : kv.second) {
+                  append_real(part_bufs[part], ccplx.scalar_from_node(idx, pnt_idx), out_precision);
+                  part_bufs[part] += ' ';
+                }
+                flush_part(part++, false);
+              }
+              part_bufs[part] += "          ";
+              for(int i=0; i<3; i++) {
+                append_real(part_bufs[part], pnt[i], out_precision);
+                part_bufs[part] += (i < 2 ? ' ' : '\n');
+              }
+              flush_part(part, false);
+            } else {
+              std::string& buf = part_bufs[0];
+              for(int i=0; i<3; i++) {
+                if (i > 0)
+                  buf += ' ';
+                append_real(buf, pnt[i], out_precision);
+              }
+              if (out_data_names.contains("COLORS")) {
+                fvec3_t clr = ccplx.fvec3_from_node(out_data_names["COLORS"], pnt_idx);
+                for(int i=0; i<3; i++) {
+                  buf += ' ';
+                  append_int(buf, static_cast<int>(255*clr[i]));
+                }
+              }
+              if (out_data_names.contains("NORMALS")) {
+                fvec3_t nml = ccplx.fvec3_from_node(out_data_names["NORMALS"], pnt_idx);
+                ccplx.vec3_unitize(nml);
+                for(int i=0; i<3; i++) {
+                  buf += ' ';
+                  append_real(buf, nml[i], out_precision);
+                }
+              }
+              buf += '\n';
+              flush_part(0, false);
+            }
+            return out_node_count++;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Write a cell.  No checks are preformed beyond making sure vertexes are already in the file.
+              @param new_cell_kind   The type of the new cell
+              @param new_cell_verts  The vertexes of the new cell (file node indexes returned by add_node()) */
+          bool add_cell(cell_kind_t new_cell_kind, cell_verts_span_t new_cell_verts) {
+            if (std::any_of(new_cell_verts.begin(), new_cell_verts.end(), [this](node_idx_t v) { return ((v < 0) || (v >= out_node_count)); }))
+              return false;
+            if (out_format == stream_format_t::XML_VTK) {
+              int part = static_cast<int>(out_data_names.size()) + 1;
+              part_bufs[part] += "          ";
+              for(auto& vert: new_cell_verts) {
+                append_int(part_bufs[part], vert);
+                part_bufs[part] += ' ';
+              }
+              part_bufs[part] += '\n';
+              out_conn_count += static_cast<node_idx_t>(new_cell_verts.size());
+              append_int(part_bufs[part+1], out_conn_count);
+              part_bufs[part+1] += ' ';
+              append_int(part_bufs[part+2], cell_kind_to_vtk_type(new_cell_kind));
+              part_bufs[part+2] += ' ';
+              for(int i=part; i<part+3; ++i)
+                flush_part(i, false);
+            } else {
+              if ( !((new_cell_kind == cell_kind_t::TRIANGLE) || (new_cell_kind == cell_kind_t::QUAD)))
+                out_bad_cell = true;
+              append_int(part_bufs[1], new_cell_verts.size());
+              part_bufs[1] += ' ';
+              for(auto& vert: new_cell_verts) {
+                append_int(part_bufs[1], vert);
+                part_bufs[1] += ' ';
+              }
+              part_bufs[1] += '\n';
+              flush_part(1, false);
+            }
+            out_cell_count++;
+            return true;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Retruns the number of nodes written so far. */
+          node_idx_t node_count() const {
+            return out_node_count;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Retruns the number of cells written so far. */
+          int num_cells() const {
+            return out_cell_count;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Assemble the output file, and remove the temporary files.
+              @return 0 if everything worked, and non-zero otherwise -- error codes match the write_*() methods */
+          io_result close() {
+            if ( !(is_open())) {
+              std::cout << "ERROR(stream_writer_t::close): Writer not open!" << std::endl;
+              return 4;
+            }
+            for(int i=0; i<static_cast<int>(part_streams.size()); ++i) {
+              flush_part(i, true);
+              part_streams[i].close();
+            }
+            io_result ret = 0;
+            if (out_node_count <= 0) {
+              std::cout << "ERROR(stream_writer_t::close): No points!" << std::endl;
+              ret = 1;
+            } else if (out_cell_count <= 0) {
+              std::cout << "ERROR(stream_writer_t::close): No cells!" << std::endl;
+              ret = 2;
+            } else if (out_bad_cell) {
+              std::cout << "ERROR(stream_writer_t::close): Cells must all be 2D (triangles or quads)!" << std::endl;
+              ret = 2;
+            } else {
+              std::ofstream out_stream;
+              out_stream.open(out_file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+              if (out_stream.is_open()) {
+                out_stream.imbue(std::locale::classic());
+                if (out_format == stream_format_t::XML_VTK)
+                  assemble_xml_vtk(out_stream);
+                else
+                  assemble_ply(out_stream);
+                out_stream.close();
+              } else {
+                std::cout << "ERROR(stream_writer_t::close): Could not open file!" << std::endl;
+                ret = 3;
+              }
+            }
+            discard_parts();
+            return ret;
+          }
+        private:
+          std::string                      out_file_name;
+          std::string                      out_description;
+          stream_format_t                  out_format = stream_format_t::XML_VTK;
+          data_name_to_node_data_idx_lst_t out_data_names;
+          node_idx_t                       out_node_count = 0;
+          int                              out_cell_count = 0;
+          node_idx_t                       out_conn_count = 0;
+          bool                             out_bad_cell = false;
+          int                              out_precision = 10;
+          std::vector<std::ofstream>       part_streams;
+          std::vector<std::string>         part_bufs;
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Size at which a section buffer is written to its temporary file. */
+          constexpr static std::size_t part_buf_size = 1 << 16;
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Name of a temporary section file. */
+          std::string part_file_name(int part) const {
+            return out_file_name + ".part" + std::to_string(part);
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Write the buffer for a section to its temporary file if it is full, or always if force is true. */
+          void flush_part(int part, bool force) {
+            if (force || (part_bufs[part].size() >= part_buf_size)) {
+              part_streams[part].write(part_bufs[part].data(), static_cast<std::streamsize>(part_bufs[part].size()));
+              part_bufs[part].clear();
+            }
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Close & remove temporary section files. */
+          void discard_parts() {
+            for(int i=0; i<static_cast<int>(part_streams.size()); ++i) {
+              if (part_streams[i].is_open())
+                part_streams[i].close();
+              std::remove(part_file_name(i).c_str());
+            }
+            part_streams.clear();
+            part_bufs.clear();
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Copy a temporary section file to the output file. */
+          void copy_part(std::ofstream& out_stream, int part) const {
+            std::ifstream in_stream(part_file_name(part), std::ios::in | std::ios::binary);
+            if (in_stream.peek() != std::ifstream::traits_type::eof())
+              out_stream << in_stream.rdbuf();
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Assemble a XML VTK file -- See: write_xml_vtk() */
+          void assemble_xml_vtk(std::ofstream& out_stream) const {
+            out_stream << "<VTKFile type='UnstructuredGrid' version='0.1' byte_order='LittleEndian'>" << std::endl;
+            out_stream << "<!-- " << out_description << " -->" << std::endl;
+            out_stream << "  <UnstructuredGrid>" << std::endl;
+            out_stream << "    <Piece NumberOfPoints='" << out_node_count << "' NumberOfCells='" << out_cell_count << "'>" << std::endl;
+            int part = 0;
+            if ( !(out_data_names.empty())) {
+              std::string scalars_attr_value, vectors_attr_value, normals_attr_value;
+              for (auto& kv : out_data_names)
+                if (kv.second.size()==1)
+                  scalars_attr_value += (scalars_attr_value.empty() ? "" : " ") + kv.first;
+                else
+                  if (kv.first == "NORMALS")
+                    normals_attr_value = "NORMALS";
+                  else
+                    vectors_attr_value += (vectors_attr_value.empty() ? "" : " ") + kv.first;
+              out_stream << "      <PointData";
+              if ( !(scalars_attr_value.empty()))
+                out_stream << " Scalars='" << scalars_attr_value << "'";
+              if ( !(normals_attr_value.empty()))
+                out_stream << " Normals='" << normals_attr_value << "'";
+              if ( !(vectors_attr_value.empty()))
+                out_stream << " Vectors='" << vectors_attr_value << "'";
+              out_stream << ">" << std::endl;
+              for (auto& kv : out_data_names) {
+                out_stream << "        <DataArray Name='" << kv.first << "' type='Float64' format='ascii' NumberOfComponents='" << kv.second.size() << "'>" << std::endl;
+                out_stream << "          ";
+                copy_part(out_stream, part++);
+                out_stream << std::endl << "        </DataArray>" << std::endl;
+              }
+              out_stream << "      </PointData>" << std::endl;
+            }
+            out_stream << "      <Points>" << std::endl;
+            out_stream << "        <DataArray Name='Points' type='Float64' format='ascii' NumberOfComponents='3'>" << std::endl;
+            copy_part(out_stream, part++);
+            out_stream << "        </DataArray>" << std::endl;
+            out_stream << "      </Points>" << std::endl;
+            out_stream << "      <Cells>" << std::endl;
+            out_stream << "        <DataArray type='Int32' Name='connectivity' format='ascii'>" << std::endl;
+            copy_part(out_stream, part++);
+            out_stream << "        </DataArray>" << std::endl;
+            out_stream << "        <DataArray type='Int32' Name='offsets' format='ascii'>" << std::endl;
+            out_stream << "          ";
+            copy_part(out_stream, part++);
+            out_stream << std::endl;
+            out_stream << "        </DataArray>" << std::endl;
+            out_stream << "        <DataArray type='Int8' Name='types' format='ascii'>" << std::endl;
+            out_stream << "          ";
+            copy_part(out_stream, part++);
+            out_stream << std::endl;
+            out_stream << "        </DataArray>" << std::endl;
+            out_stream << "      </Cells>" << std::endl;
+            out_stream << "    </Piece>" << std::endl;
+            out_stream << "  </UnstructuredGrid>" << std::endl;
+            out_stream << "</VTKFile>" << std::endl;
+            out_stream << std::endl;
+          }
+          //----------------------------------------------------------------------------------------------------------------------------------------------------
+          /** Assemble a PLY file -- See: write_ply() */
+          void assemble_ply(std::ofstream& out_stream) const {
+            out_stream << "ply" << std::endl;
+            out_stream << "format ascii 1.0" << std::endl;
+            out_stream << "comment software: Mitch Richling's MR_rect_tree package" << std::endl;
+            out_stream << "comment note: " << out_description << std::endl;
+            out_stream << "element vertex " << out_node_count << std::endl;
+            out_stream << "property float x" << std::endl;
+            out_stream << "property float y" << std::endl;
+            out_stream << "property float z" << std::endl;
+            if (out_data_names.contains("COLORS")) {
+              out_stream << "property uchar red" << std::endl;
+              out_stream << "property uchar green" << std::endl;
+              out_stream << "property uchar blue" << std::endl;
+            }
+            if (out_data_names.contains("NORMALS")) {
+              out_stream << "property float nx" << std::endl;
+              out_stream << "property float ny" << std::endl;
+              out_stream << "property float nz" << std::endl;
+            }
+            out_stream << "element face " << out_cell_count << std::endl;
+            out_stream << "property list uchar int vertex_index" << std::endl;
+            out_stream << "end_header" << std::endl;
+            copy_part(out_stream, 0);
+            copy_part(out_stream, 1);
+            out_stream << std::endl;
+          }
+      };
       //@}
 
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1653,7 +3082,7 @@ namespace mjr {
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Return true if any component of the point has a NaN.
           @param test_pnt The point to test */
-      inline bool pnt_has_nan(const fvec3_t& test_pnt) {
+      inline bool pnt_has_nan(const fvec3_t& test_pnt) const {
         return (std::isnan(test_pnt[0]) || std::isnan(test_pnt[1]) || std::isnan(test_pnt[2]));
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1685,22 +3114,26 @@ namespace mjr {
       typedef std::function<bool(const node_data_t&)>        p2bool_func_t;                // pd2b
       /** Function that takes a cell and returns a bool (Cell Predicate) */
       typedef std::function<bool(const cell_verts_t&)>             c2bool_func_t;                // c2b
+      /** Function that takes a cell index and returns a bool (Cell Index Predicate) */
+      typedef std::function<bool(int)>                             ci2bool_func_t;               // ci2b
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Delete cells matching a predicate function.
 
+          When chk_cell_unique is true, deleted cells are also removed from the unique cell index -- i.e. they may be added again later.
+
           @param func       Predicate function -- if true we get rid of the cell */
       int cull_cells(c2bool_func_t func) {
-        int idx_last_good = -1;
-        int start_size = num_cells();
-        for(int i=0; i<start_size; i++)
-          if ( !(func(cell_lst[i]))) {
-            idx_last_good++;
-            if (idx_last_good != i)
-              cell_lst[idx_last_good] = cell_lst[i];
-          }
-        idx_last_good++;
-        cell_lst.resize(idx_last_good);
-        return (start_size-num_cells());
+        return cull_cells_impl([&func](int, const cell_verts_t& cell_verts) { return func(cell_verts); });
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Delete cells by index.
+
+          Cells are tested in order, and the remaining cells keep their relative order -- so a caller may track cells with a list parallel to the cells
+          (See: MR_rt_to_cc::update_geometry_fans()).  As with cull_cells(), deleted cells are removed from the unique cell index.
+
+          @param func       Predicate function given the index of a cell before any cells are removed -- if true we get rid of the cell */
+      int cull_cells_by_index(ci2bool_func_t func) {
+        return cull_cells_impl([&func](int cell_idx, const cell_verts_t&) { return func(cell_idx); });
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Add new cells with points from existing cells with the given coordinates negated.
@@ -1713,22 +3146,24 @@ namespace mjr {
           @param flip_list            A vector of booleans (0 or 1).  1 indicates the coordinate in a node_data_t vector should be negated.
           @param zero_epsilon         If non-negative, will collapse flipped coordinates near zero to be precisely zero.
           @param reverse_vertex_order Reverse the order of vertexes in each cell -- useful if vertex order impacts rendering. */
-      void mirror(std::vector<int> flip_list, uft_t zero_epsilon=epsilon*1000, bool reverse_vertex_order=true) {
+      void mirror(const std::vector<int>& flip_list, uft_t zero_epsilon=epsilon*1000, bool reverse_vertex_order=true) {
         int num_start_cells = num_cells();
         for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx) {
           cell_verts_t new_cell;
-          for(auto pidx: cell_lst[cell_idx]) {
-            node_data_t od = node_idx_to_node_data[pidx];
+          for(node_idx_t conn_idx=cell_offsets[cell_idx]; conn_idx<cell_offsets[cell_idx+1]; ++conn_idx) {
+            node_idx_t pidx = cell_conn[conn_idx];
+            node_data_t od = get_node_data(pidx);
             for(int flip_list_idx=0; flip_list_idx<static_cast<int>(flip_list.size()); ++flip_list_idx)
-              if ((flip_list[flip_list_idx]) && (std::abs(od[flip_list_idx]) < zero_epsilon))
+              if ((flip_list[flip_list_idx]) && (std::abs(od[flip_list_idx]) < zero_epsilon)) {
                 od[flip_list_idx] = 0;
-            node_idx_to_node_data[pidx] = od;
+                set_node_data_value(pidx, flip_list_idx, 0);
+              }
             fvec3_t new_old_pnt = fvec3_from_node_data(node_data_to_pnt, od);
             if constexpr (chk_point_unique) {
-              if (pnt_to_node_idx_map.contains(new_old_pnt))
-                if (pnt_to_node_idx_map[new_old_pnt] != pidx)
+              if (int e = pnt_hash_find(new_old_pnt); e >= 0)
+                if (pnt_hash_entries[e].idx != pidx)
                   std::cout << "ERROR(mirror): Collapse caused collision!" << std::endl;
-              pnt_to_node_idx_map[new_old_pnt] = pidx;
+              pnt_hash_insert(new_old_pnt, pidx);
             }
             node_data_t nd = od;
             for(int flip_list_idx=0; flip_list_idx<static_cast<int>(flip_list.size()); ++flip_list_idx)
@@ -1739,58 +3174,133 @@ namespace mjr {
           }
           if (reverse_vertex_order)
             std::reverse(new_cell.begin(), new_cell.end());
-          add_cell(req_pt_cnt_to_cell_kind(new_cell.size()), new_cell);
+          add_cell(get_cell_kind(cell_idx), new_cell);
         }
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Clear the solution cache stored in edge_solver_sdf(). */
+      /** Add the nodes, cells, & named datasets of another complex to this one.
+
+          Nodes are added as with add_node(), and cells are added as with add_cell() -- with node indexes remapped.  When chk_point_unique is true, only
+          nodes of other_cplx inside the bounding box of the nodes already in this complex (grown by eps) are looked up in the point index.  All others can't
+          be duplicates of existing nodes, and are added directly.  Note other_cplx's nodes are assumed to be unique among themselves when both complexes
+          use the same point mapping.
+
+          Named datasets in other_cplx with names not in this complex are added.  If this complex has no point mapping, then other_cplx's is used.
+
+          @param other_cplx  The complex to add
+          @return Index in this complex of each node in other_cplx (-1 for nodes that could not be added) */
+      node_idx_list_t append(const MR_cell_cplx& other_cplx) {
+        if (&other_cplx == this) {
+          MR_cell_cplx other_copy(other_cplx);
+          return append(other_copy);
+        }
+        // Named datasets & point mapping
+        for(const auto& kv: other_cplx.data_name_to_data_idx_lst)
+          data_name_to_data_idx_lst.insert(kv);
+        if (node_data_to_pnt.empty())
+          node_data_to_pnt = (other_cplx.node_data_to_pnt.empty() ? node_data_idx_lst_t({0, 1, 2}) : other_cplx.node_data_to_pnt);
+        bool same_pnt_map = (node_data_to_pnt == other_cplx.node_data_to_pnt);
+        // Bounding box of existing nodes
+        fvec3_t bb_min { std::numeric_limits<uft_t>::max(),  std::numeric_limits<uft_t>::max(),  std::numeric_limits<uft_t>::max()};
+        fvec3_t bb_max {-std::numeric_limits<uft_t>::max(), -std::numeric_limits<uft_t>::max(), -std::numeric_limits<uft_t>::max()};
+        for(const auto& pnt: node_idx_to_pnt)
+          for(int i=0; i<3; ++i) {
+            bb_min[i] = std::min(bb_min[i], pnt[i]-eps);
+            bb_max[i] = std::max(bb_max[i], pnt[i]+eps);
+          }
+        // Nodes
+        node_idx_list_t node_remap(static_cast<std::size_t>(other_cplx.node_count()));
+        node_store_reserve(node_remap.size(), static_cast<std::size_t>(other_cplx.node_count() > 0 ? other_cplx.node_data_size(0) : 0));
+        for(node_idx_t i=0; i<other_cplx.node_count(); ++i) {
+          fvec3_t pnt = (same_pnt_map ? other_cplx.get_pnt(i) : fvec3_from_node_data(node_data_to_pnt, other_cplx.get_node_data(i)));
+          bool in_overlap = !same_pnt_map || ( (pnt[0] >= bb_min[0]) && (pnt[0] <= bb_max[0]) &&
+                                               (pnt[1] >= bb_min[1]) && (pnt[1] <= bb_max[1]) &&
+                                               (pnt[2] >= bb_min[2]) && (pnt[2] <= bb_max[2]) );
+          node_remap[static_cast<std::size_t>(i)] = add_node_pnt(other_cplx.get_node_data(i), pnt, in_overlap);
+        }
+        // Cells
+        cell_store_reserve(static_cast<std::size_t>(other_cplx.num_cells()), other_cplx.cell_conn.size());
+        std::array<node_idx_t, 8> new_cell;
+        for(int cell_idx=0; cell_idx<other_cplx.num_cells(); ++cell_idx) {
+          cell_verts_span_t other_cell = other_cplx.get_cell_verts(cell_idx);
+          // other_cplx may have been built without vertex checks, so cells may be too long or refer to nodes that don't exist.
+          bool all_good = (other_cell.size() <= new_cell.size());
+          for(std::size_t k=0; all_good && (k<other_cell.size()); ++k) {
+            all_good = (other_cell[k] >= 0) && (other_cell[k] < other_cplx.node_count());
+            if (all_good) {
+              new_cell[k] = node_remap[static_cast<std::size_t>(other_cell[k])];
+              all_good = (new_cell[k] >= 0);
+            }
+          }
+          if (all_good)
+            add_cell(other_cplx.get_cell_kind(cell_idx), cell_verts_span_t(new_cell.data(), other_cell.size()));
+        }
+        return node_remap;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Set the root finder used by edge_solver_sdf(). */
+      void set_edge_solver(edge_solver_t new_edge_solver) {
+        edge_solver = new_edge_solver;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Retruns the root finder used by edge_solver_sdf(). */
+      edge_solver_t get_edge_solver() const {
+        return edge_solver;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Retruns the number of SDF evaluations made by edge_solver_sdf() since the last clear_edge_solver_sdf_counts(). */
+      std::size_t edge_solver_sdf_eval_count() const {
+        return edge_solver_eval_cnt;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Retruns the number of edges solved by edge_solver_sdf() (i.e. not found in the cache) since the last clear_edge_solver_sdf_counts(). */
+      std::size_t edge_solver_sdf_solve_count() const {
+        return edge_solver_solve_cnt;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Reset edge_solver_sdf_eval_count() & edge_solver_sdf_solve_count() to zero. */
+      void clear_edge_solver_sdf_counts() {
+        edge_solver_eval_cnt = 0;
+        edge_solver_solve_cnt = 0;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Clear the solution cache used by edge_solver_sdf(). */
       void clear_cache_edge_solver_sdf() {
-        edge_solver_sdf(nullptr, 0, 0, nullptr, 0.0);
+        edge_solver_cache.clear();
+        edge_solver_cache_cnt = 0;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Solve an SDF function for zero on a line between two node data sets, and add the solution to the central node data.
+      /** Solve an SDF function for zero on a line between two nodes, and return the node data for the solution.
 
-          The SDF must have different signs on the given points.  If this is not the case, then the endpoint with SDF closest to zero will be returned.
-
-          Uses bisection.  Halting conditions:
-          - The SDF value at the most recent guess is within solve_epsilon of zero
-          - The absolute difference in SDF values at the end points is less than solve_epsilon
-
-          This function stores a cache of previous solution results.  This cache may be cleared by clear_cache_edge_solver_sdf().
+          This is the solver used by edge_solver_sdf() -- see that function for details.  Unlike edge_solver_sdf(), this function doesn't use the solver
+          cache, and doesn't modify the object.  So it may be called from several threads at once (if sdf_func may be).
 
           @param pnt_idx1       First edge vertex
           @param pnt_idx2       Second edge vertex
-          @param sdf_func       Data function (if nullptr, then clear solver cache and return immediately)
+          @param sdf_func       SDF function
           @param solve_epsilon  Used to detect SDF value near zero
-          @param dat_func       Produce the node data vector for the newly solved point. */
-      node_idx_t edge_solver_sdf(p2data_func_t dat_func, node_idx_t pnt_idx1, node_idx_t pnt_idx2, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10) {
-        // Solver cache.
-        static std::unordered_map<node_idx_t, std::unordered_map<node_idx_t, node_idx_t>> edge_solver_cache;
-        if (sdf_func == nullptr) {
-          edge_solver_cache.clear();
-          return pnt_idx1;
-        }
-        node_idx_t cache_key1 = std::min(pnt_idx1, pnt_idx2);
-        node_idx_t cache_key2 = std::max(pnt_idx1, pnt_idx2);
-        // Check to see if we solved this one before
-        if (edge_solver_cache.contains(cache_key1))
-          if (edge_solver_cache[cache_key1].contains(cache_key2))
-            return edge_solver_cache[cache_key1][cache_key2];
-        // Gotta do the work and solve...
-        // Init neg&pos with the points that have eng&pos sdf values
+          @param num_evals      Incremented by the number of SDF evaluations */
+      node_data_t solve_edge_sdf(node_idx_t pnt_idx1, node_idx_t pnt_idx2, const p2real_func_t& sdf_func, uft_t solve_epsilon, std::size_t& num_evals) const {
+        // Init neg&pos with the points that have eng&pos sdf values.  neg_t & pos_t are the locations of neg&pos on the edge (0 at pnt_idx1 & 1 at pnt_idx2)
         node_data_t neg_node_data;
         uft_t      neg_pnt_sdfv;
-        node_data_t pos_node_data = node_idx_to_node_data[pnt_idx1];
+        uft_t      neg_t;
+        node_data_t pos_node_data = get_node_data(pnt_idx1);
         uft_t      pos_pnt_sdfv = sdf_func(pos_node_data);
+        uft_t      pos_t = 0;
         if (pos_pnt_sdfv > 0) {
-          neg_node_data = node_idx_to_node_data[pnt_idx2];
+          neg_node_data = get_node_data(pnt_idx2);
           neg_pnt_sdfv = sdf_func(neg_node_data);
+          neg_t = 1;
         } else {
           neg_node_data = pos_node_data;
           neg_pnt_sdfv = pos_pnt_sdfv;
-          pos_node_data = node_idx_to_node_data[pnt_idx2];
+          neg_t = 0;
+          pos_node_data = get_node_data(pnt_idx2);
           pos_pnt_sdfv = sdf_func(pos_node_data);
+          pos_t = 1;
         }
+        num_evals += 2;
         // Init sol_node_data to end point with sdf value nearest zero
         node_data_t sol_node_data;
         uft_t      sol_pnt_sdfv;
@@ -1802,79 +3312,296 @@ namespace mjr {
           sol_pnt_sdfv = neg_pnt_sdfv;
         }
         if (neg_pnt_sdfv < 0) {  // Just to make sure pos&neg are pos&neg...
-          while ((std::abs(sol_pnt_sdfv) > solve_epsilon) && (pos_pnt_sdfv-neg_pnt_sdfv) > solve_epsilon) {
+          // ILLINOIS state: end point sdf values used for the false position step (halved when an end point is retained twice), & last end point replaced
+          uft_t ill_neg_sdfv = neg_pnt_sdfv;
+          uft_t ill_pos_sdfv = pos_pnt_sdfv;
+          int   ill_last_side = 0;
+          // BRENT state: b is the best guess, c is the other end of the bracket, a is the previous b, d is the last step, and e is the step before that.
+          uft_t brent_b  = (std::abs(pos_pnt_sdfv) < std::abs(neg_pnt_sdfv) ? pos_t : neg_t);
+          uft_t brent_fb = (std::abs(pos_pnt_sdfv) < std::abs(neg_pnt_sdfv) ? pos_pnt_sdfv : neg_pnt_sdfv);
+          uft_t brent_c  = (std::abs(pos_pnt_sdfv) < std::abs(neg_pnt_sdfv) ? neg_t : pos_t);
+          uft_t brent_fc = (std::abs(pos_pnt_sdfv) < std::abs(neg_pnt_sdfv) ? neg_pnt_sdfv : pos_pnt_sdfv);
+          uft_t brent_a  = brent_c;
+          uft_t brent_fa = brent_fc;
+          uft_t brent_d  = brent_b - brent_c;
+          uft_t brent_e  = brent_d;
+          // ITP state: Parameters k1=0.2, k2=2, n0=1, and t tolerance itp_eps.  itp_j is the iteration count.
+          constexpr uft_t itp_eps   = 4 * uft_epsilon;
+          const int       itp_n_max = static_cast<int>(std::ceil(std::log2(1 / (2 * itp_eps)))) + 1;
+          int             itp_j     = 0;
+          while ((std::abs(sol_pnt_sdfv) > solve_epsilon) && ((pos_pnt_sdfv-neg_pnt_sdfv) > solve_epsilon) && (std::abs(pos_t-neg_t) > itp_eps)) {
+            // New guess is (1-w)*neg_node_data + w*pos_node_data
+            uft_t w = static_cast<uft_t>(0.5);
+            switch(edge_solver) {
+              case edge_solver_t::BISECTION: {
+                break;
+              }
+              case edge_solver_t::ILLINOIS: {
+                w = ill_neg_sdfv / (ill_neg_sdfv - ill_pos_sdfv);
+                break;
+              }
+              case edge_solver_t::BRENT: {
+                if (std::abs(brent_fc) < std::abs(brent_fb)) {
+                  brent_a = brent_b;  brent_fa = brent_fb;
+                  brent_b = brent_c;  brent_fb = brent_fc;
+                  brent_c = brent_a;  brent_fc = brent_fa;
+                }
+                uft_t tol = 2 * uft_epsilon;
+                uft_t m   = (brent_c - brent_b) / 2;
+                if ((std::abs(brent_e) >= tol) && (std::abs(brent_fa) > std::abs(brent_fb))) {
+                  uft_t s = brent_fb / brent_fa;
+                  uft_t p, q;
+                  if (brent_a == brent_c) {  // Secant
+                    p = 2 * m * s;
+                    q = 1 - s;
+                  } else {                   // Inverse quadratic interpolation
+                    q = brent_fa / brent_fc;
+                    uft_t r = brent_fb / brent_fc;
+                    p = s * (2 * m * q * (q - r) - (brent_b - brent_a) * (r - 1));
+                    q = (q - 1) * (r - 1) * (s - 1);
+                  }
+                  if (p > 0)
+                    q = -q;
+                  else
+                    p = -p;
+                  if (2 * p < std::min(3 * m * q - std::abs(tol * q), std::abs(brent_e * q))) {
+                    brent_e = brent_d;
+                    brent_d = p / q;
+                  } else {
+                    brent_d = m;
+                    brent_e = brent_d;
+                  }
+                } else {
+                  brent_d = m;
+                  brent_e = brent_d;
+                }
+                uft_t new_t = brent_b + (std::abs(brent_d) > tol ? brent_d : std::copysign(tol, m));
+                w = (new_t - neg_t) / (pos_t - neg_t);
+                break;
+              }
+              case edge_solver_t::ITP: {
+                uft_t width  = std::abs(pos_t - neg_t);
+                uft_t t_half = (neg_t + pos_t) / 2;
+                uft_t t_f    = (pos_pnt_sdfv * neg_t - neg_pnt_sdfv * pos_t) / (pos_pnt_sdfv - neg_pnt_sdfv);
+                uft_t sigma  = std::copysign(static_cast<uft_t>(1), t_half - t_f);
+                uft_t delta  = static_cast<uft_t>(0.2) * width * width;
+                uft_t t_t    = (delta <= std::abs(t_half - t_f) ? t_f + sigma * delta : t_half);
+                uft_t r      = std::max(static_cast<uft_t>(0), std::ldexp(itp_eps, itp_n_max - itp_j) - width / 2);
+                uft_t new_t  = (std::abs(t_t - t_half) <= r ? t_t : t_half - sigma * r);
+                itp_j++;
+                w = (new_t - neg_t) / (pos_t - neg_t);
+                break;
+              }
+            }
+            // Keep the guess strictly inside the bracket
+            w = std::clamp(w, uft_epsilon, 1 - uft_epsilon);
+            uft_t sol_t = (1 - w) * neg_t + w * pos_t;
             for(decltype(pos_node_data.size()) i=0; i<pos_node_data.size(); i++)
-              sol_node_data[i] = (pos_node_data[i] + neg_node_data[i])/static_cast<uft_t>(2.0);
+              sol_node_data[i] = (1 - w) * neg_node_data[i] + w * pos_node_data[i];
             sol_pnt_sdfv = sdf_func(sol_node_data);
+            num_evals++;
             if (sol_pnt_sdfv > 0) {
               pos_node_data = sol_node_data;
               pos_pnt_sdfv = sol_pnt_sdfv;
+              pos_t = sol_t;
+              if (ill_last_side > 0)
+                ill_neg_sdfv /= 2;
+              ill_pos_sdfv = sol_pnt_sdfv;
+              ill_last_side = 1;
             } else {
               neg_node_data = sol_node_data;
               neg_pnt_sdfv = sol_pnt_sdfv;
+              neg_t = sol_t;
+              if (ill_last_side < 0)
+                ill_pos_sdfv /= 2;
+              ill_neg_sdfv = sol_pnt_sdfv;
+              ill_last_side = -1;
+            }
+            brent_a  = brent_b;
+            brent_fa = brent_fb;
+            brent_b  = sol_t;
+            brent_fb = sol_pnt_sdfv;
+            if ((brent_fb > 0) == (brent_fc > 0)) {
+              brent_c  = brent_a;
+              brent_fc = brent_fa;
+              brent_d  = brent_b - brent_a;
+              brent_e  = brent_d;
             }
           }
         }
+        return sol_node_data;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Solve an SDF function for zero on a line between two node data sets, and add the solution to the central node data.
+
+          The SDF must have different signs on the given points.  If this is not the case, then the endpoint with SDF closest to zero will be returned.
+
+          The root finder is selected with set_edge_solver() (See: edge_solver_t).  All of them maintain a bracket with SDF values of opposite sign, and
+          share the same halting conditions:
+          - The SDF value at the most recent guess is within solve_epsilon of zero
+          - The absolute difference in SDF values at the end points is less than solve_epsilon
+          - The bracket can no longer be split (width on the edge near floating point epsilon)
+
+          The number of SDF evaluations is recorded (See: edge_solver_sdf_eval_count()).
+
+          This function stores a cache of previous solution results in the object.  This cache may be cleared by clear_cache_edge_solver_sdf().  As the
+          cache is part of the object, different objects may be folded on different threads.
+
+          @param pnt_idx1       First edge vertex
+          @param pnt_idx2       Second edge vertex
+          @param sdf_func       Data function (if nullptr, then clear solver cache and return immediately)
+          @param solve_epsilon  Used to detect SDF value near zero
+          @param dat_func       Produce the node data vector for the newly solved point. */
+      node_idx_t edge_solver_sdf(p2data_func_t dat_func, node_idx_t pnt_idx1, node_idx_t pnt_idx2, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10) {
+        if (sdf_func == nullptr) {
+          clear_cache_edge_solver_sdf();
+          return pnt_idx1;
+        }
+        std::uint64_t cache_key = edge_solver_cache_key(pnt_idx1, pnt_idx2);
+        // Check to see if we solved this one before
+        if (node_idx_t cached_idx = edge_solver_cache_find(cache_key); cached_idx >= 0)
+          return cached_idx;
+        // Gotta do the work and solve...
+        edge_solver_solve_cnt++;
+        node_data_t sol_node_data = solve_edge_sdf(pnt_idx1, pnt_idx2, sdf_func, solve_epsilon, edge_solver_eval_cnt);
         // Add out point, update solver cache, and return index
         node_idx_t sol_pnt_idx = add_node(dat_func(sol_node_data));
-        edge_solver_cache[cache_key1][cache_key2] = sol_pnt_idx;
+        if (sol_pnt_idx >= 0)
+          edge_solver_cache_insert(cache_key, sol_pnt_idx);
         return sol_pnt_idx;
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Fold triangles that cross over an SDF function.
-          @param data_func      Data function
-          @param sdf_func       SDF function
-          @param solve_epsilon  Used to detect SDF value near zero */
-      void triangle_folder(p2data_func_t data_func, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10) {
-        clear_cache_edge_solver_sdf();
+
+          Folding happens in three phases:
+          - The SDF is evaluated on every triangle vertex, and each triangle is classified by the signs of its vertexes
+          - The unique edges crossing the SDF boundary (and not already in the edge_solver_sdf() cache) are solved
+          - The new nodes & triangles are added to the complex in cell order
+          The first two phases may be run on several threads, and the result does not depend upon the number of threads.  When num_threads is not 1,
+          data_func & sdf_func must be safe to call from several threads at once.
+
+          @param data_func        Data function
+          @param sdf_func         SDF function
+          @param solve_epsilon    Used to detect SDF value near zero
+          @param clear_edge_cache Clear the edge_solver_sdf() cache before folding.  Set to false to reuse edges solved by a previous fold with the same
+                                  data_func, sdf_func, & solve_epsilon.
+          @param num_threads      Number of threads to use for the first two phases.  Zero means std::thread::hardware_concurrency(). */
+      void triangle_folder(p2data_func_t data_func, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10, bool clear_edge_cache=true, int num_threads=1) {
+        if (clear_edge_cache)
+          clear_cache_edge_solver_sdf();
         int num_start_cells = num_cells();
-        for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx) {
-          if (static_cast<int>(cell_lst[cell_idx].size()) == cell_kind_to_req_pt_cnt(cell_kind_t::TRIANGLE)) {
-            auto& cur_cell = cell_lst[cell_idx];
-            // Find and count zeros, positive, and negative vertexes
-            int zero_cnt= 0, plus_cnt= 0, negv_cnt= 0;
-            int zero_loc=-1, plus_loc=-1, negv_loc=-1;
-            for(int i=0; i<3; i++) {
-              uft_t sdf_val = sdf_func(node_idx_to_node_data[cur_cell[i]]);
-              if (std::abs(sdf_val) <= solve_epsilon) {
-                zero_cnt++;
-                zero_loc = i;
-              } else {
-                if (sdf_val < static_cast<uft_t>(0.0)) {
-                  plus_cnt++;
-                  plus_loc = i;
+        // Phase 1: SDF for each vertex of a triangle, and classify triangles.
+        //          tri_case is 0 if the triangle is not folded, 1 if it becomes three triangles, and 2 if it becomes two triangles.
+        //          tri_perm is the index into pmat used to rotate the triangle vertexes.
+        const std::array<std::array<int, 3>, 3> pmat { { {0, 1, 2}, {1, 2, 0}, {2, 0, 1} } };
+        std::vector<std::uint8_t> node_used(static_cast<std::size_t>(node_count()), 0);
+        for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx)
+          if (get_cell_kind(cell_idx) == cell_kind_t::TRIANGLE)
+            for(auto v: get_cell_verts(cell_idx))
+              node_used[static_cast<std::size_t>(v)] = 1;
+        node_idx_list_t sdf_nodes;
+        for(node_idx_t i=0; i<node_count(); ++i)
+          if (node_used[static_cast<std::size_t>(i)])
+            sdf_nodes.push_back(i);
+        std::vector<uft_t> node_sdf(static_cast<std::size_t>(node_count()));
+        parallel_for(sdf_nodes.size(), num_threads, [&](std::size_t begin, std::size_t end, int) {
+          for(std::size_t i=begin; i<end; ++i)
+            node_sdf[static_cast<std::size_t>(sdf_nodes[i])] = sdf_func(get_node_data(sdf_nodes[i]));
+        });
+        std::vector<std::uint8_t> tri_case(static_cast<std::size_t>(num_start_cells), 0);
+        std::vector<std::uint8_t> tri_perm(static_cast<std::size_t>(num_start_cells), 0);
+        parallel_for(static_cast<std::size_t>(num_start_cells), num_threads, [&](std::size_t begin, std::size_t end, int) {
+          for(std::size_t cell_idx=begin; cell_idx<end; ++cell_idx) {
+            if (get_cell_kind(static_cast<int>(cell_idx)) == cell_kind_t::TRIANGLE) {
+              cell_verts_span_t cur_cell = get_cell_verts(static_cast<int>(cell_idx));
+              // Find and count zeros, positive, and negative vertexes
+              int zero_cnt= 0, plus_cnt= 0, negv_cnt= 0;
+              int zero_loc=-1, plus_loc=-1, negv_loc=-1;
+              for(int i=0; i<3; i++) {
+                uft_t sdf_val = node_sdf[static_cast<std::size_t>(cur_cell[i])];
+                if (std::abs(sdf_val) <= solve_epsilon) {
+                  zero_cnt++;
+                  zero_loc = i;
                 } else {
-                  negv_cnt++;
-                  negv_loc = i;
+                  if (sdf_val < static_cast<uft_t>(0.0)) {
+                    plus_cnt++;
+                    plus_loc = i;
+                  } else {
+                    negv_cnt++;
+                    negv_loc = i;
+                  }
                 }
               }
+              if ((zero_cnt == 0) && (plus_cnt > 0) && (negv_cnt >0)) { // three triangles
+                tri_case[cell_idx] = 1;
+                tri_perm[cell_idx] = static_cast<std::uint8_t>(plus_cnt == 1 ? plus_loc : negv_loc);
+              } else if ((zero_cnt == 1) && (plus_cnt == 1) && (negv_cnt == 1)) { // two triangles
+                tri_case[cell_idx] = 2;
+                tri_perm[cell_idx] = static_cast<std::uint8_t>(zero_loc);
+              }
             }
-            const std::vector<std::array<int, 3>> pmat { {0, 1, 2}, {1, 2, 0}, {2, 0, 1}};
-            std::array<int, 3> p;
-            if ((zero_cnt == 0) && (plus_cnt > 0) && (negv_cnt >0)) { // three triangles
-              if (plus_cnt == 1)
-                p = pmat[plus_loc];
-              else
-                p = pmat[negv_loc];
-              auto orgv0 = cur_cell[p[0]];
-              auto orgv1 = cur_cell[p[1]];
-              auto orgv2 = cur_cell[p[2]];
-              auto newv1 = edge_solver_sdf(data_func, orgv0, orgv1, sdf_func, solve_epsilon);
-              auto newv2 = edge_solver_sdf(data_func, orgv0, orgv2, sdf_func, solve_epsilon);
+          }
+        });
+        // Phase 2: Solve each crossing edge once.  Edges are listed in the order they are used in phase 3, with the same vertex order.
+        std::vector<std::pair<node_idx_t, node_idx_t>> edges;
+        std::unordered_map<std::uint64_t, std::size_t> edge_key_to_edge;
+        auto note_edge = [&](node_idx_t pnt_idx1, node_idx_t pnt_idx2) {
+          std::uint64_t key = edge_solver_cache_key(pnt_idx1, pnt_idx2);
+          if ((edge_solver_cache_find(key) < 0) && edge_key_to_edge.try_emplace(key, edges.size()).second)
+            edges.emplace_back(pnt_idx1, pnt_idx2);
+        };
+        for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx) {
+          if (tri_case[static_cast<std::size_t>(cell_idx)] != 0) {
+            cell_verts_span_t cur_cell = get_cell_verts(cell_idx);
+            const auto& p = pmat[tri_perm[static_cast<std::size_t>(cell_idx)]];
+            if (tri_case[static_cast<std::size_t>(cell_idx)] == 1) {
+              note_edge(cur_cell[p[0]], cur_cell[p[1]]);
+              note_edge(cur_cell[p[0]], cur_cell[p[2]]);
+            } else {
+              note_edge(cur_cell[p[1]], cur_cell[p[2]]);
+            }
+          }
+        }
+        std::vector<node_data_t> edge_node_data(edges.size());
+        std::vector<std::size_t> thread_evals(static_cast<std::size_t>(parallel_for_threads(edges.size(), num_threads)), 0);
+        parallel_for(edges.size(), num_threads, [&](std::size_t begin, std::size_t end, int thread_idx) {
+          for(std::size_t i=begin; i<end; ++i)
+            edge_node_data[i] = data_func(solve_edge_sdf(edges[i].first, edges[i].second, sdf_func, solve_epsilon, thread_evals[static_cast<std::size_t>(thread_idx)]));
+        });
+        edge_solver_solve_cnt += edges.size();
+        for(auto n: thread_evals)
+          edge_solver_eval_cnt += n;
+        // Phase 3: Add new nodes & triangles in cell order.
+        auto edge_node = [&](node_idx_t pnt_idx1, node_idx_t pnt_idx2) {
+          std::uint64_t key = edge_solver_cache_key(pnt_idx1, pnt_idx2);
+          node_idx_t sol_pnt_idx = edge_solver_cache_find(key);
+          if (sol_pnt_idx < 0) {
+            sol_pnt_idx = add_node(edge_node_data[edge_key_to_edge[key]]);
+            if (sol_pnt_idx >= 0)
+              edge_solver_cache_insert(key, sol_pnt_idx);
+          }
+          return sol_pnt_idx;
+        };
+        for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx) {
+          if (tri_case[static_cast<std::size_t>(cell_idx)] != 0) {
+            const auto& p = pmat[tri_perm[static_cast<std::size_t>(cell_idx)]];
+            node_idx_t* cur_cell = cell_conn.data() + cell_offsets[cell_idx];  // Invalidated by add_cell()
+            auto orgv0 = cur_cell[p[0]];
+            auto orgv1 = cur_cell[p[1]];
+            auto orgv2 = cur_cell[p[2]];
+            if (tri_case[static_cast<std::size_t>(cell_idx)] == 1) { // three triangles
+              auto newv1 = edge_node(orgv0, orgv1);
+              auto newv2 = edge_node(orgv0, orgv2);
               if ((newv1 != orgv0) && (newv1 != orgv1) && (newv2 != orgv0) && (newv2 != orgv2)) {
                 cur_cell[p[1]] = newv1; // Modify current triangle in place
                 cur_cell[p[2]] = newv2; // Modify current triangle in place
                 add_cell(cell_kind_t::TRIANGLE, {newv1, orgv1, newv2});  // Add new triangle
                 add_cell(cell_kind_t::TRIANGLE, {orgv1, orgv2, newv2});  // Add new triangle
               }
-            } else if ((zero_cnt == 1) && (plus_cnt == 1) && (negv_cnt == 1)) { // two triangles
-              p = pmat[zero_loc];
-              auto orgv0 = cur_cell[p[0]];
-              auto orgv1 = cur_cell[p[1]];
-              auto orgv2 = cur_cell[p[2]];
-              auto newv0 = edge_solver_sdf(data_func, orgv1, orgv2, sdf_func, solve_epsilon);
+            } else {                                                  // two triangles
+              auto newv0 = edge_node(orgv1, orgv2);
               if ((newv0 != orgv1) && (newv0 != orgv2)) {
-                cur_cell[2] = newv0; // Modify current triangle in place
+                cur_cell[p[2]] = newv0; // Modify current triangle in place
                 add_cell(cell_kind_t::TRIANGLE, {orgv0, newv0, orgv2});  // Add new triangle
               }
             }
@@ -1883,18 +3610,21 @@ namespace mjr {
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Fold segments that cross over an SDF function.
-          @param data_func      Data function
-          @param sdf_func       SDF function
-          @param solve_epsilon  Used to detect SDF value near zero */
-      void segment_folder(p2data_func_t data_func, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10) {
-        clear_cache_edge_solver_sdf();
+          @param data_func        Data function
+          @param sdf_func         SDF function
+          @param solve_epsilon    Used to detect SDF value near zero
+          @param clear_edge_cache Clear the edge_solver_sdf() cache before folding.  Set to false to reuse edges solved by a previous fold with the same
+                                  data_func, sdf_func, & solve_epsilon. */
+      void segment_folder(p2data_func_t data_func, p2real_func_t sdf_func, uft_t solve_epsilon=epsilon/10, bool clear_edge_cache=true) {
+        if (clear_edge_cache)
+          clear_cache_edge_solver_sdf();
         int num_start_cells = num_cells();
         for(int cell_idx=0; cell_idx<num_start_cells; ++cell_idx) {
-          if (static_cast<int>(cell_lst[cell_idx].size()) == cell_kind_to_req_pt_cnt(cell_kind_t::SEGMENT)) {
-            auto& cur_cell = cell_lst[cell_idx];
+          if (get_cell_kind(cell_idx) == cell_kind_t::SEGMENT) {
+            node_idx_t* cur_cell = cell_conn.data() + cell_offsets[cell_idx];  // Invalidated by add_cell()
             int plus_cnt=0,  negv_cnt=0;
             for(int i=0; i<2; i++) {
-              uft_t sdf_val = sdf_func(node_idx_to_node_data[cur_cell[i]]);
+              uft_t sdf_val = sdf_func(get_node_data(cur_cell[i]));
               if (sdf_val < static_cast<uft_t>(0.0))
                 plus_cnt++;
               else if (sdf_val > static_cast<uft_t>(0.0))
@@ -1919,18 +3649,18 @@ namespace mjr {
       //@{
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Return true if ALL vertexes are above the level by more than epsilon */
-      bool cell_above_level(const cell_verts_t cell_verts, int level_index, uft_t level, uft_t level_epsilon=epsilon) {
-        return std::all_of(cell_verts.cbegin(), cell_verts.cend(), [this, level_index, level, level_epsilon](int v) { return (node_idx_to_node_data[v][level_index] > level+level_epsilon); });
+      bool cell_above_level(cell_verts_span_t cell_verts, int level_index, uft_t level, uft_t level_epsilon=epsilon) {
+        return std::all_of(cell_verts.begin(), cell_verts.end(), [this, level_index, level, level_epsilon](int v) { return (get_node_data_value(v, level_index) > level+level_epsilon); });
       }
       /** Return true if ALL vertexes are below the level by more than epsilon */
-      bool cell_below_level(const cell_verts_t cell_verts, int level_index, uft_t level, uft_t level_epsilon=epsilon) {
-        return std::all_of(cell_verts.cbegin(), cell_verts.cend(), [this, level_index, level, level_epsilon](int v) { return (node_idx_to_node_data[v][level_index] < level+level_epsilon); });
+      bool cell_below_level(cell_verts_span_t cell_verts, int level_index, uft_t level, uft_t level_epsilon=epsilon) {
+        return std::all_of(cell_verts.begin(), cell_verts.end(), [this, level_index, level, level_epsilon](int v) { return (get_node_data_value(v, level_index) < level+level_epsilon); });
       }
       /** Return true if cell is near SDF boundry */
-      bool cell_near_sdf_boundry(const cell_verts_t cell_verts, p2real_func_t sdf_function, uft_t sdf_epsilon=epsilon) {
+      bool cell_near_sdf_boundry(cell_verts_span_t cell_verts, p2real_func_t sdf_function, uft_t sdf_epsilon=epsilon) {
         int pos_cnt=0, neg_cnt=0;
         for(auto v: cell_verts) {
-          uft_t sv = sdf_function(node_idx_to_node_data[v]);
+          uft_t sv = sdf_function(get_node_data(v));
           if (mjr::math::fnear_zero(sv, sdf_epsilon))
             return true;
           if (sv < 0) {
@@ -40,6 +40,12 @@
 #include <vector>                                                        /* STL vector              C++11    */
 #include <string>                                                        /* C++ strings             C++11    */
 #include <variant>                                                       /* C++ variant type        C++17    */
+#include <algorithm>                                                     /* STL algorithm           C++11    */
+#include <cstdint>                                                       /* std:: C stdint.h        C++11    */
+#include <iterator>                                                      /* STL iterators           C++11    */
+#include <span>                                                          /* STL span                C++20    */
+#include <ranges>                                                        /* STL ranges              C++20    */
+#include <concepts>                                                      /* C++ concepts            C++20    */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Put everything in the mjr namespace
@@ -68,6 +74,9 @@ namespace mjr {
       typedef typename cc_t::node_idx_list_t     cc_node_idx_list_t;
       typedef typename cc_t::node_idx_t          cc_node_idx_t;
       typedef typename cc_t::cell_verts_t              cc_cell_verts_t;
+      typedef typename cc_t::cell_verts_span_t   cc_cell_verts_span_t;
+      typedef typename cc_t::cell_kind_t         cc_cell_kind_t;
+      typedef typename cc_t::stream_writer_t     cc_stream_writer_t;
       typedef typename cc_t::uft_t               cc_uft_t;
       typedef typename rt_t::diti_list_t         rt_diti_list_t;
       typedef typename rt_t::diti_t              rt_diti_t;
@@ -77,6 +86,19 @@ namespace mjr {
       typedef typename rt_t::drpt2rrpt_func_t    rt_drpt2rrpt_func_t;
       //@}
 
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Node data records. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of values in the node data for a tree point -- domain components followed by range components. */
+      constexpr static int node_rec_size = rt_t::domain_dimension + rt_t::range_dimension;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Node data for a tree point.  The size is known at compile time, so these live on the stack and are passed to MR_cell_cplx::add_node() as a
+          std::span -- no heap allocation is required to build a node.  With the MR_cc_node_store_t::FLAT or MR_cc_node_store_t::COLUMNS node stores no heap
+          allocation is required to store one either. */
+      typedef std::array<cc_uft_t, node_rec_size> node_rec_t;
+      //@}
+
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       /** @name Describe point source. */
       //@{
@@ -97,6 +119,56 @@ namespace mjr {
       typedef std::vector<val_src_t> val_src_lst_t;
       //@}
 
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Edge healing. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Solution for an edge with one good point and one NaN point (See: nan_edge_solver() & nan_heal_table()). */
+      struct nan_heal_t {
+          rt_diti_t     sick_diti;  //!< NaN point in the tree
+          rt_diti_t     good_diti;  //!< Good point in the tree
+          rt_drpt_t     dom_pnt;    //!< Solution domain point
+          rt_rrpt_t     rng_pnt;    //!< Solution range point
+          bool          use_good;   //!< Solution is too close to the good point, so the good point should be used
+          cc_node_idx_t ccplx_idx;  //!< Index of the solution in the MR_cell_cplx (-2 until it has been added)
+      };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** A list of nan_heal_t objects sorted by sick_diti & good_diti. */
+      typedef std::vector<nan_heal_t> nan_heal_table_t;
+      //@}
+
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Tree point to complex node map. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** An entry in a node_cache_t -- a tree point and its index in the MR_cell_cplx (-1 if the point has a NaN).  Empty slots have an index of -2. */
+      struct node_cache_entry_t {
+          rt_diti_t     diti;
+          cc_node_idx_t idx;
+      };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Map from tree points to MR_cell_cplx node indexes.  This is an open addressing hash table with a power of 2 size.  Each tree point shared by
+          several cells is converted & added to the MR_cell_cplx only once. */
+      struct node_cache_t {
+          std::vector<node_cache_entry_t> slots;     //!< Hash slots
+          std::size_t                     cnt = 0;   //!< Number of used slots
+      };
+      //@}
+
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Incremental geometry construction. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** State kept by update_geometry_fans() between calls.  Start with a default constructed object & an empty MR_cell_cplx, and give the same pair to
+          every call. */
+      struct bridge_state_t {
+          rt_diti_list_t   leaves;      //!< Sorted leaf cells at the last update
+          rt_diti_list_t   cell_owner;  //!< Leaf cell that produced each MR_cell_cplx cell
+          node_cache_t     node_cache;  //!< Map from tree points to MR_cell_cplx node indexes
+          nan_heal_table_t heal_table;  //!< Healed edges.  Node indexes are for the MR_cell_cplx.
+      };
+      //@}
+
     private:
       //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       /** @name Utility Functions. */
@@ -126,30 +198,92 @@ namespace mjr {
         return add_node(ccplx, rtree.diti_to_drpt(diti), rtree.get_sample(diti));
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Find the slot in node_cache holding diti, or the empty slot where it would go.  node_cache.slots must not be empty. */
+      inline static std::size_t node_cache_slot(const node_cache_t& node_cache, rt_diti_t diti) {
+        std::size_t mask = node_cache.slots.size() - 1;
+        std::uint64_t h = static_cast<std::uint64_t>(diti);
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        std::size_t i = static_cast<std::size_t>(h ^ (h >> 31)) & mask;
+        while ((node_cache.slots[i].idx != -2) && (node_cache.slots[i].diti != diti))
+          i = (i + 1) & mask;
+        return i;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Make sure node_cache can hold num_points points without growing.
+          @param node_cache  The cache
+          @param num_points  Number of points */
+      static void node_cache_reserve(node_cache_t& node_cache, std::size_t num_points) {
+        if (4 * num_points <= 3 * node_cache.slots.size())
+          return;
+        std::size_t new_size = std::max(std::size_t(64), node_cache.slots.size());
+        while (4 * num_points > 3 * new_size)
+          new_size *= 2;
+        std::vector<node_cache_entry_t> old_slots(new_size, {rt_diti_t(), -2});
+        std::swap(old_slots, node_cache.slots);
+        for(auto& old_entry: old_slots)
+          if (old_entry.idx != -2)
+            node_cache.slots[node_cache_slot(node_cache, old_entry.diti)] = old_entry;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Given rt coordinates, extract point/scalar/vector data, and add point/data to cc -- only the first time diti is seen.
+          @param ccplx       The MR_cell_cplx to populate with geometry
+          @param rtree       The MR_rect_tree with source data
+          @param diti        The point coordinate in rtree
+          @param node_cache  Map from tree points to ccplx node indexes */
+      inline static cc_node_idx_t add_node(cc_t& ccplx, const rt_t& rtree, rt_diti_t diti, node_cache_t& node_cache) {
+        node_cache_reserve(node_cache, node_cache.cnt + 1);
+        std::size_t i = node_cache_slot(node_cache, diti);
+        if (node_cache.slots[i].idx == -2) {
+          node_cache.slots[i] = {diti, add_node(ccplx, rtree, diti)};
+          node_cache.cnt++;
+        }
+        return node_cache.slots[i].idx;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Given rt coordinates, extract point/scalar/vector data, and add point/data to cc
           @param ccplx    The MR_cell_cplx to populate with geometry
           @param dom_pnt  Domain point
           @param rng_pnt  Range point */
       inline static cc_node_idx_t add_node(cc_t& ccplx, rt_drpt_t dom_pnt, rt_rrpt_t rng_pnt) {
-        return ccplx.add_node(rt_pnt_to_cc_pnt(dom_pnt, rng_pnt));
+        node_rec_t rec = rt_pnt_to_node_rec(dom_pnt, rng_pnt);
+        return ccplx.add_node(std::span<const cc_uft_t>(rec));
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
-      /** Given rt_t domain & range points, produce a cc_t point data vector.
+      /** Given rt_t domain & range points, produce a node_rec_t.
           @param dom_pnt  Domain point
           @param rng_pnt  Range point */
-      inline static cc_node_data_t rt_pnt_to_cc_pnt(rt_drpt_t dom_pnt, rt_rrpt_t rng_pnt)  {
-        cc_node_data_t pd;
+      inline static node_rec_t rt_pnt_to_node_rec(const rt_drpt_t& dom_pnt, const rt_rrpt_t& rng_pnt)  {
+        node_rec_t rec;
         if constexpr (rt_t::domain_dimension == 1)
-          pd.push_back(dom_pnt);
+          rec[0] = static_cast<cc_uft_t>(dom_pnt);
         else
-          for(auto v: dom_pnt)
-            pd.push_back(v);
+          for(int i=0; i<rt_t::domain_dimension; ++i)
+            rec[i] = static_cast<cc_uft_t>(dom_pnt[i]);
         if constexpr (rt_t::range_dimension == 1)
-          pd.push_back(rng_pnt);
+          rec[rt_t::domain_dimension] = static_cast<cc_uft_t>(rng_pnt);
         else
-          for(auto v: rng_pnt)
-            pd.push_back(v);
-        return pd;
+          for(int i=0; i<rt_t::range_dimension; ++i)
+            rec[rt_t::domain_dimension+i] = static_cast<cc_uft_t>(rng_pnt[i]);
+        return rec;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Copy the data for a node created from a tree point (See: rt_pnt_to_node_rec()) out of a MR_cell_cplx without building a cc_node_data_t.
+          @param ccplx    The MR_cell_cplx
+          @param pnt_idx  Node index */
+      inline static node_rec_t ccplx_node_rec(const cc_t& ccplx, cc_node_idx_t pnt_idx)  {
+        node_rec_t rec;
+        for(int i=0; i<node_rec_size; ++i)
+          rec[i] = ccplx.get_node_data_value(pnt_idx, i);
+        return rec;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Given rt_t domain & range points, produce a cc_t point data vector.
+          @param dom_pnt  Domain point
+          @param rng_pnt  Range point */
+      inline static cc_node_data_t rt_pnt_to_cc_pnt(rt_drpt_t dom_pnt, rt_rrpt_t rng_pnt)  {
+        node_rec_t rec = rt_pnt_to_node_rec(dom_pnt, rng_pnt);
+        return cc_node_data_t(rec.begin(), rec.end());
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Transform a MR_cell_cplx::node_data_t value into MR_rect_tree::drpt_t.  
@@ -164,6 +298,524 @@ namespace mjr {
         }
         return ret;
       }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Return true if add_node() would reject a tree point because its geometric point has a NaN.
+          @param ccplx  The MR_cell_cplx with the point mapping
+          @param rtree  The MR_rect_tree with source data
+          @param diti   The point coordinate in rtree */
+      inline static bool node_is_nan(const cc_t& ccplx, const rt_t& rtree, rt_diti_t diti) {
+        node_rec_t rec = rt_pnt_to_node_rec(rtree.diti_to_drpt(diti), rtree.get_sample(diti));
+        return ccplx.pnt_has_nan(ccplx.fvec3_from_node_data(ccplx.node_data_to_pnt, std::span<const cc_uft_t>(rec)));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** One face of a fan stencil -- the tree corners of a face (or part of a face) of a 2D or 3D cell.  Each face becomes a triangle (2D) or pyramid (3D)
+          with the cell center.  For 2D cells flip indicates the corners must be swapped to get the triangle orientation. */
+      struct fan_face_t {
+          std::array<rt_diti_t, (rt_t::domain_dimension == 3 ? 4 : 2)> corners;
+          bool                                                         flip;
+      };
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Faces construct_geometry_fans() uses for a cell.  One object is reused for every cell, so the storage is only allocated once per call. */
+      typedef std::vector<fan_face_t> fan_stencil_t;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Vertex lists for cells built by construct_geometry_fans().  They live on the stack, and are passed to MR_cell_cplx::add_cell() as spans. */
+      typedef std::array<cc_node_idx_t, 2> fan_seg_verts_t;
+      typedef std::array<cc_node_idx_t, 3> fan_tri_verts_t;
+      typedef std::array<cc_node_idx_t, 5> fan_pyr_verts_t;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Fill stencil with the faces of a 2D or 3D cell.  When a neighbor across a face is refined, the face is split along the neighbor's cells.  The tree
+          is asked for the neighbors across each face only once.
+          @param rtree    The MR_rect_tree with source data
+          @param cell     The cell
+          @param stencil  Filled with the faces */
+      static void fan_stencil(const rt_t& rtree, rt_diti_t cell, fan_stencil_t& stencil) {
+        stencil.clear();
+        for(int i=0; i<rt_t::domain_dimension; i++) {
+          for(int j=-1; j<2; j+=2) {
+            bool flip = (rt_t::domain_dimension == 2) && ( ((i == 0) && (j == -1)) || ((i == 1) && (j == 1)) );
+            rt_diti_list_t nbrs = rtree.get_existing_neighbor(cell, i, j);
+            if (nbrs.size() > 1) {
+              for(auto n: nbrs) {
+                rt_diti_list_t corners = rtree.ccc_get_corners(n, i, -j);
+                stencil.push_back({{}, flip});
+                std::copy_n(corners.begin(), stencil.back().corners.size(), stencil.back().corners.begin());
+              }
+            } else {
+              rt_diti_list_t corners = rtree.ccc_get_corners(cell, i, j);
+              stencil.push_back({{}, flip});
+              std::copy_n(corners.begin(), stencil.back().corners.size(), stencil.back().corners.begin());
+            }
+          }
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Triangle construct_geometry_fans() creates for a face of a 2D cell -- two tree corners & the cell center.
+          @param face  Face from fan_stencil()
+          @param cell  The cell */
+      inline static std::array<rt_diti_t, 3> fan_triangle(const fan_face_t& face, rt_diti_t cell) {
+        if (face.flip)
+          return {face.corners[1], face.corners[0], cell};
+        else
+          return {face.corners[0], face.corners[1], cell};
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Cells across the faces of a cell -- the cells construct_geometry_fans() looks at when it constructs geometry for the cell.
+          @param rtree  The MR_rect_tree with source data
+          @param cell   The cell */
+      inline static rt_diti_list_t face_neighbors(const rt_t& rtree, rt_diti_t cell) {
+        rt_diti_list_t nbrs;
+        if constexpr (rt_t::domain_dimension > 1) {
+          for(int i=0; i<rt_t::domain_dimension; i++) {
+            for(int j=-1; j<2; j+=2) {
+              rt_diti_list_t face_nbrs = rtree.get_existing_neighbor(cell, i, j);
+              nbrs.insert(nbrs.end(), face_nbrs.begin(), face_nbrs.end());
+            }
+          }
+        }
+        return nbrs;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Order for nan_heal_table_t entries */
+      inline static bool nan_heal_less(const nan_heal_t& a, const nan_heal_t& b) {
+        return (a.sick_diti < b.sick_diti) || ((a.sick_diti == b.sick_diti) && (a.good_diti < b.good_diti));
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Bisect an edge with one good point and one NaN point.  See: nan_edge_solver() */
+      static nan_heal_t nan_edge_solve(const rt_t& rtree, rt_diti_t good_point_rtree_index, rt_diti_t sick_point_rtree_index, rt_drpt2rrpt_func_t func, cc_uft_t solver_epsilon) {
+        rt_drpt_t good_point_drpt = rtree.diti_to_drpt(good_point_rtree_index);
+        rt_drpt_t sick_point_drpt = rtree.diti_to_drpt(sick_point_rtree_index);
+        rt_rrpt_t good_point_rrpt = rtree.get_sample(good_point_rtree_index);
+        rt_drpt_t init_point_drpt = good_point_drpt;
+        while ( (rtree.drpt_distance_inf(good_point_drpt, sick_point_drpt) > solver_epsilon) ) {
+          rt_drpt_t md_point_drpt = rtree.drpt_midpoint(good_point_drpt, sick_point_drpt);
+          rt_rrpt_t y = func(md_point_drpt);
+          if (rtree.rrpt_is_nan(y)) {
+            sick_point_drpt = md_point_drpt;
+          } else {
+            good_point_drpt = md_point_drpt;
+            good_point_rrpt = y;
+          }
+        }
+        return {sick_point_rtree_index, good_point_rtree_index, good_point_drpt, good_point_rrpt, (rtree.drpt_distance_inf(good_point_drpt, init_point_drpt) < cc_t::epsilon), -2};
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Look up a healed edge in a nan_heal_table_t, and add the solution to ccplx (only the first time).  Edges missing from the table are solved.
+          @param ccplx                   The MR_cell_cplx to populate with geometry
+          @param rtree                   The MR_rect_tree with source data
+          @param heal_table              Table from nan_heal_table()
+          @param good_point_ccplx_index  Good point index in the ccplx object
+          @param good_point_rtree_index  Good point index in the rtree object
+          @param sick_point_rtree_index  Bad point index in the rtree object
+          @param func                    The function to use for the solver */
+      static cc_node_idx_t heal_edge(cc_t&               ccplx,
+                                     const rt_t&         rtree,
+                                     nan_heal_table_t&   heal_table,
+                                     cc_node_idx_t       good_point_ccplx_index,
+                                     rt_diti_t           good_point_rtree_index,
+                                     rt_diti_t           sick_point_rtree_index,
+                                     rt_drpt2rrpt_func_t func) {
+        nan_heal_t key {sick_point_rtree_index, good_point_rtree_index, rt_drpt_t(), rt_rrpt_t(), true, -2};
+        auto heal = std::lower_bound(heal_table.begin(), heal_table.end(), key, nan_heal_less);
+        if ((heal == heal_table.end()) || nan_heal_less(key, *heal))
+          return nan_edge_solver(ccplx, rtree, good_point_ccplx_index, good_point_rtree_index, sick_point_rtree_index, func);
+        if (heal->ccplx_idx == -2)
+          heal->ccplx_idx = (heal->use_good ? good_point_ccplx_index : add_node(ccplx, heal->dom_pnt, heal->rng_pnt));
+        return heal->ccplx_idx;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Work horse for construct_geometry_fans().  The point mapping must already be set in ccplx.
+          @param ccplx             The MR_cell_cplx to populate with geometry
+          @param rtree             The MR_rect_tree with source data
+          @param cells             List of cells to output from rtree
+          @param output_dimension  Parts of cells to output
+          @param func              The function was used to sample the tree
+          @param heal_table        Table from nan_heal_table()
+          @param node_cache        Map from tree points to ccplx node indexes */
+      static int fans_to_ccplx(cc_t&                      ccplx,
+                               const rt_t&                rtree,
+                               std::span<const rt_diti_t> cells,
+                               int                        output_dimension,
+                               const rt_drpt2rrpt_func_t& func,
+                               nan_heal_table_t&          heal_table,
+                               node_cache_t&              node_cache
+                              ) {
+        fan_stencil_t stencil;
+        if constexpr (rt_t::domain_dimension == 1) {
+          for(auto& cell: cells) {
+            cc_node_idx_t ctr_pnti = add_node(ccplx, rtree, cell, node_cache);
+            rt_diti_list_t corners = rtree.ccc_get_corners(cell);
+            cc_node_idx_t cn0_pnti = add_node(ccplx, rtree, corners[0], node_cache);
+            cc_node_idx_t cn1_pnti = add_node(ccplx, rtree, corners[1], node_cache);
+            if (func) { // We have a func, so we can "heal" broken edges.
+              if (ctr_pnti < 0) { // Center: Broken. Left:
+                if(cn0_pnti >= 0) { // Center: Broken.  Left: Good.
+                  cc_node_idx_t np = heal_edge(ccplx, rtree, heal_table, cn0_pnti, corners[0], cell, func);
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{cn0_pnti, np}, output_dimension);
+                }
+                if(cn1_pnti >= 0) { // Center: Broken.  Right: Good.
+                  cc_node_idx_t np = heal_edge(ccplx, rtree, heal_table, cn1_pnti, corners[1], cell, func);
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{np, cn1_pnti}, output_dimension);
+                }
+              } else {             // Center: Good.
+                if(cn0_pnti < 0) { // Center: Good.  Left: Broken.
+                  cc_node_idx_t np = heal_edge(ccplx, rtree, heal_table, ctr_pnti, cell, corners[0], func);
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{np, ctr_pnti}, output_dimension);
+                } else {           // Center: Good.  Left: Good.
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{cn0_pnti, ctr_pnti}, output_dimension);
+                }
+                if(cn1_pnti < 0) { // Center: Good.  Right: Broken.
+                  cc_node_idx_t np = heal_edge(ccplx, rtree, heal_table, ctr_pnti, cell, corners[1], func);
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{ctr_pnti, np}, output_dimension);
+                } else {           // Center: Good.  Left: Good.
+                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{ctr_pnti, cn1_pnti}, output_dimension);
+                }
+              }
+            } else {
+              ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{cn0_pnti, ctr_pnti}, output_dimension);
+              ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, fan_seg_verts_t{ctr_pnti, cn1_pnti}, output_dimension);
+            }
+          }
+        } else if constexpr (rt_t::domain_dimension == 2) {
+          for(auto& cell: cells) {
+            if (func) { // We have a func, so we can "heal" broken edges.
+              fan_stencil(rtree, cell, stencil);
+              for(auto& face: stencil) {
+                std::array<rt_diti_t, 3> triangle = fan_triangle(face, cell);
+                fan_tri_verts_t tpnts {add_node(ccplx, rtree, triangle[0], node_cache),
+                                       add_node(ccplx, rtree, triangle[1], node_cache),
+                                       add_node(ccplx, rtree, triangle[2], node_cache)};
+                int num_bad = static_cast<int>(std::count_if(tpnts.begin(), tpnts.end(), [](cc_node_idx_t i) { return i<0; }));
+                if (num_bad == 0) {
+                  ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, tpnts, output_dimension);
+                } else if ((num_bad == 1) || (num_bad == 2)) {
+                  // Rotate points so we only have two cases to think about...
+                  std::array<int, 3> p {0, 1, 2};
+                  if ( ((tpnts[1] < 0) && (num_bad == 1)) || ((tpnts[1] >= 0) && (num_bad == 2)) )
+                    p = {1, 2, 0};
+                  else if ( ((tpnts[2] < 0) && (num_bad == 1)) || ((tpnts[2] >= 0) && (num_bad == 2)) )
+                    p = {2, 0, 1};
+                  // Solve for edge 0-1 & 0-2
+                  if (num_bad == 1) {
+                    cc_node_idx_t np1 = heal_edge(ccplx, rtree, heal_table, tpnts[p[1]], triangle[p[1]], triangle[p[0]], func);
+                    cc_node_idx_t np2 = heal_edge(ccplx, rtree, heal_table, tpnts[p[2]], triangle[p[2]], triangle[p[0]], func);
+                    ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, fan_tri_verts_t{np1, tpnts[p[1]], tpnts[p[2]]}, output_dimension);
+                    ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, fan_tri_verts_t{tpnts[p[2]], np2, np1}, output_dimension);
+                  } else {
+                    cc_node_idx_t np1 = heal_edge(ccplx, rtree, heal_table, tpnts[p[0]], triangle[p[0]], triangle[p[1]], func);
+                    cc_node_idx_t np2 = heal_edge(ccplx, rtree, heal_table, tpnts[p[0]], triangle[p[0]], triangle[p[2]], func);
+                    ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, fan_tri_verts_t{tpnts[p[0]], np1, np2}, output_dimension);
+                  }
+                }
+              }
+            } else { // We don't have a func, so we can can't "heal" broken edges.  This is much faster. ;)
+              cc_node_idx_t ctr_pnti = add_node(ccplx, rtree, cell, node_cache);
+              if (ctr_pnti >= 0) { // Center point was good, let's try and make some triangles...
+                fan_stencil(rtree, cell, stencil);
+                for(auto& face: stencil) {
+                  cc_node_idx_t cn0_pnti = add_node(ccplx, rtree, face.corners[0], node_cache);
+                  cc_node_idx_t cn1_pnti = add_node(ccplx, rtree, face.corners[1], node_cache);
+                  if (face.flip)
+                    std::swap(cn0_pnti, cn1_pnti);
+                  ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, fan_tri_verts_t{cn0_pnti, cn1_pnti, ctr_pnti}, output_dimension);
+                }
+              }
+            }
+          }
+        } else if constexpr (rt_t::domain_dimension == 3) {
+          const std::array<int, 4> p {0, 1, 3, 2};
+          fan_pyr_verts_t new_cell;
+          for(auto& cell: cells) {
+            new_cell[4] = add_node(ccplx, rtree, cell, node_cache);
+            if (new_cell[4] >= 0) { // Center point was good, let's try and make some pyramids...
+              fan_stencil(rtree, cell, stencil);
+              for(auto& face: stencil) {
+                for(int k=0; k<4; ++k)
+                  new_cell[p[k]] = add_node(ccplx, rtree, face.corners[k], node_cache);
+                ccplx.add_cell(cc_t::cell_kind_t::PYRAMID, new_cell, output_dimension);
+              }
+            }
+          }
+        } else { // if (rtree.domain_dimension > 3) {
+          std::cout << "ERROR: construct_geometry_fans: output_dimension>3 not supported for output_dimension>0!" << std::endl;
+          return 1;
+        }
+        return 0;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Work horse for construct_geometry_rects().  The point mapping must already be set in ccplx.
+          @param ccplx                The MR_cell_cplx to populate with geometry
+          @param rtree                The MR_rect_tree with source data
+          @param cells                List of cells to output from rtree
+          @param output_dimension     Parts of cells to output
+          @param degenerate_fallback  Try to construct a triangle when a quad fails
+          @param node_cache           Map from tree points to ccplx node indexes */
+      static int rects_to_ccplx(cc_t&                      ccplx,
+                                const rt_t&                rtree,
+                                std::span<const rt_diti_t> cells,
+                                int                        output_dimension,
+                                bool                       degenerate_fallback,
+                                node_cache_t&              node_cache
+                               ) {
+        for(auto& cell: cells) {
+          std::vector<cc_node_idx_t> cnr_pti;
+          rt_diti_list_t corners = rtree.ccc_get_corners(cell);
+          for(auto& corner: corners) {
+            cc_node_idx_t pnti = add_node(ccplx, rtree, corner, node_cache);
+            cnr_pti.push_back(pnti);
+          }
+          if (rtree.domain_dimension == 1) {
+            ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {cnr_pti[0], cnr_pti[1]}, output_dimension);
+          } else if (rtree.domain_dimension == 2) {
+            const std::array<int, 4> p = {0, 1, 3, 2};
+            bool try_harder = !(ccplx.add_cell(cc_t::cell_kind_t::QUAD, {cnr_pti[0], cnr_pti[1], cnr_pti[3], cnr_pti[2]}, output_dimension));
+            if ( degenerate_fallback && try_harder) { // Try for a triangle if we have a NaN point or an adjacent pair of duplicate points
+              for(int i=0; i<4; i++) {
+                if ((cnr_pti[p[i]] < 0) || (cnr_pti[p[(i+0)%4]] == cnr_pti[p[(i+1)%4]])) {
+                  ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {cnr_pti[p[(i+1)%4]], cnr_pti[p[(i+2)%4]], cnr_pti[p[(i+3)%4]]}, output_dimension);
+                  break;
+                }
+              }
+            }
+          } else { // if(rtree.domain_dimension == 3) {
+            ccplx.add_cell(cc_t::cell_kind_t::HEXAHEDRON,
+                           {cnr_pti[0], cnr_pti[1], cnr_pti[3], cnr_pti[2],
+                            cnr_pti[4], cnr_pti[5], cnr_pti[7], cnr_pti[6]},
+                           output_dimension);
+          }
+        }
+        return 0;
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Merge the nodes & cells of local_ccplx into a target (a MR_cell_cplx or a cc_t::stream_writer_t).
+
+          local_ccplx was constructed from the tree with local_node_cache & local_heal_table.  Nodes are merged in local_ccplx order, and tree points &
+          healed edge points are looked up in node_cache & heal_table -- so the result is the same as if the cells had been constructed in the target
+          directly.  heal_table must hold every edge in local_heal_table.
+
+          @param node_cache        Map from tree points to target node indexes
+          @param heal_table        Healed edge table for the target
+          @param local_ccplx       Source MR_cell_cplx
+          @param local_node_cache  Map from tree points to local_ccplx node indexes
+          @param local_heal_table  Healed edge table for local_ccplx
+          @param add_node_func     Add local_ccplx node to target, and return the target node index
+          @param add_cell_func     Add a cell to target */
+      template<typename add_node_func_t, typename add_cell_func_t>
+      static void merge_ccplx(node_cache_t&           node_cache,
+                              nan_heal_table_t&       heal_table,
+                              const cc_t&             local_ccplx,
+                              const node_cache_t&     local_node_cache,
+                              const nan_heal_table_t& local_heal_table,
+                              add_node_func_t&&       add_node_func,
+                              add_cell_func_t&&       add_cell_func
+                             ) {
+        // Find the source of each local node: 0 => unknown, 1 => tree point, 2 => healed edge
+        std::size_t local_node_count = static_cast<std::size_t>(local_ccplx.node_count());
+        std::vector<int>         local_node_src(local_node_count, 0);
+        std::vector<rt_diti_t>   local_node_diti(local_node_count);
+        std::vector<std::size_t> local_node_heal(local_node_count);
+        for(auto& entry: local_node_cache.slots) {
+          if (entry.idx >= 0) {
+            std::size_t i = static_cast<std::size_t>(entry.idx);
+            if (local_node_src[i] == 0) {
+              local_node_src[i]  = 1;
+              local_node_diti[i] = entry.diti;
+            }
+          }
+        }
+        for(std::size_t h=0; h<local_heal_table.size(); ++h) {
+          if ((local_heal_table[h].ccplx_idx >= 0) && !local_heal_table[h].use_good) {
+            std::size_t i = static_cast<std::size_t>(local_heal_table[h].ccplx_idx);
+            if (local_node_src[i] == 0) {
+              local_node_src[i]  = 2;
+              local_node_heal[i] = h;
+            }
+          }
+        }
+        // Merge nodes
+        std::vector<cc_node_idx_t> node_remap(local_node_count);
+        for(std::size_t i=0; i<local_node_count; ++i) {
+          cc_node_idx_t local_idx = static_cast<cc_node_idx_t>(i);
+          if (local_node_src[i] == 1) {
+            node_cache_reserve(node_cache, node_cache.cnt + 1);
+            std::size_t slot = node_cache_slot(node_cache, local_node_diti[i]);
+            if (node_cache.slots[slot].idx == -2) {
+              node_cache.slots[slot] = {local_node_diti[i], add_node_func(local_idx)};
+              node_cache.cnt++;
+            }
+            node_remap[i] = node_cache.slots[slot].idx;
+          } else if (local_node_src[i] == 2) {
+            auto heal = std::lower_bound(heal_table.begin(), heal_table.end(), local_heal_table[local_node_heal[i]], nan_heal_less);
+            if (heal->ccplx_idx == -2)
+              heal->ccplx_idx = add_node_func(local_idx);
+            node_remap[i] = heal->ccplx_idx;
+          } else {
+            node_remap[i] = add_node_func(local_idx);
+          }
+        }
+        // Merge cells.  When cc_t doesn't check vertexes, cells may have negative vertexes (NaN points).  These are passed through unchanged.
+        std::array<cc_node_idx_t, 8> new_cell;
+        for(int cell_idx=0; cell_idx<local_ccplx.num_cells(); ++cell_idx) {
+          cc_cell_verts_span_t local_cell = local_ccplx.get_cell_verts(cell_idx);
+          for(std::size_t k=0; k<local_cell.size(); ++k)
+            new_cell[k] = (local_cell[k] < 0 ? local_cell[k] : node_remap[static_cast<std::size_t>(local_cell[k])]);
+          add_cell_func(local_ccplx.get_cell_kind(cell_idx), cc_cell_verts_span_t(new_cell.data(), local_cell.size()));
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Merge the nodes & cells of local_ccplx into ccplx.
+          @param ccplx             Target MR_cell_cplx
+          @param node_cache        Map from tree points to ccplx node indexes
+          @param heal_table        Healed edge table for ccplx
+          @param local_ccplx       Source MR_cell_cplx
+          @param local_node_cache  Map from tree points to local_ccplx node indexes
+          @param local_heal_table  Healed edge table for local_ccplx */
+      static void merge_ccplx(cc_t&                   ccplx,
+                              node_cache_t&           node_cache,
+                              nan_heal_table_t&       heal_table,
+                              const cc_t&             local_ccplx,
+                              const node_cache_t&     local_node_cache,
+                              const nan_heal_table_t& local_heal_table
+                             ) {
+        merge_ccplx(node_cache, heal_table, local_ccplx, local_node_cache, local_heal_table,
+                    [&ccplx, &local_ccplx](cc_node_idx_t local_idx) { node_rec_t rec = ccplx_node_rec(local_ccplx, local_idx); return ccplx.add_node(std::span<const cc_uft_t>(rec)); },
+                    [&ccplx](cc_cell_kind_t kind, cc_cell_verts_span_t verts) { ccplx.add_cell(kind, verts); });
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Construct geometry for cells with build(cur_ccplx, cur_cells, cur_heal_table, cur_node_cache).
+
+          With one thread build() is called on ccplx.  Otherwise cells are split into contiguous chunks, one per thread, and each chunk is built into a
+          thread local MR_cell_cplx.  The thread local objects are then merged into ccplx in chunk order with merge_ccplx().
+
+          @param ccplx        The MR_cell_cplx to populate with geometry.  The point mapping must already be set.
+          @param rtree        The MR_rect_tree with source data
+          @param cells        List of cells to output from rtree
+          @param point_src    Point sources
+          @param heal_table   Table from nan_heal_table()
+          @param node_cache   Map from tree points to ccplx node indexes
+          @param num_threads  Number of threads (zero means std::thread::hardware_concurrency())
+          @param build        Work function
+          @return Largest return from build() */
+      template<typename build_t>
+      static int parallel_construct(cc_t&                      ccplx,
+                                    const rt_t&                rtree,
+                                    std::span<const rt_diti_t> cells,
+                                    const val_src_lst_t&       point_src,
+                                    nan_heal_table_t&          heal_table,
+                                    node_cache_t&              node_cache,
+                                    int                        num_threads,
+                                    build_t&&                  build
+                                   ) {
+        int real_num_threads = cc_t::parallel_for_threads(cells.size(), num_threads);
+        node_cache_reserve(node_cache, node_cache.cnt + 2*cells.size());
+        if (real_num_threads == 1)
+          return build(ccplx, cells, heal_table, node_cache);
+        std::size_t num_chunks = static_cast<std::size_t>(real_num_threads);
+        nan_heal_table_t fresh_heal_table(heal_table);  // Node indexes in heal_table are for ccplx, not the thread local objects
+        for(auto& heal: fresh_heal_table)
+          heal.ccplx_idx = -2;
+        std::vector<cc_t>             local_ccplx(num_chunks);
+        std::vector<node_cache_t>     local_node_cache(num_chunks);
+        std::vector<nan_heal_table_t> local_heal_table(num_chunks, fresh_heal_table);
+        std::vector<int>              local_ret(num_chunks, 0);
+        cc_t::parallel_for(cells.size(), num_threads, [&](std::size_t begin, std::size_t end, int thread_idx) {
+          std::size_t t = static_cast<std::size_t>(thread_idx);
+          create_dataset_to_point_mapping(rtree, local_ccplx[t], point_src);
+          node_cache_reserve(local_node_cache[t], 2*(end-begin));
+          local_ret[t] = build(local_ccplx[t], cells.subspan(begin, end-begin), local_heal_table[t], local_node_cache[t]);
+        });
+        for(std::size_t t=0; t<num_chunks; ++t)
+          merge_ccplx(ccplx, node_cache, heal_table, local_ccplx[t], local_node_cache[t], local_heal_table[t]);
+        return *std::max_element(local_ret.begin(), local_ret.end());
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Number of cells buffered at a time by for_each_cell_block() for cell ranges that are not contiguous. */
+      constexpr static std::size_t cell_block_size = 65536;
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Call block_func(block) for blocks of cells from a range, and return the largest value returned by block_func().
+
+          Contiguous ranges of rt_diti_t (rt_diti_list_t, std::span, etc...) are passed to block_func() in one block without a copy.  Other ranges (a
+          std::views::filter over a list of cells, a std::generator, etc...) are consumed in one pass, and buffered cell_block_size cells at a time.
+
+          @param cells       The cells
+          @param block_func  Work function */
+      template<typename cells_range_t, typename block_func_t>
+      static int for_each_cell_block(cells_range_t&& cells, block_func_t&& block_func) {
+        if constexpr (std::ranges::contiguous_range<cells_range_t> && std::ranges::sized_range<cells_range_t> &&
+                      std::is_same_v<std::ranges::range_value_t<cells_range_t>, rt_diti_t>) {
+          return block_func(std::span<const rt_diti_t>(std::ranges::data(cells), std::ranges::size(cells)));
+        } else {
+          int ret = 0;
+          rt_diti_list_t block;
+          block.reserve(cell_block_size);
+          for(auto&& cell: cells) {
+            block.push_back(cell);
+            if (block.size() == cell_block_size) {
+              ret = std::max(ret, block_func(std::span<const rt_diti_t>(block)));
+              block.clear();
+            }
+          }
+          if ( !(block.empty()))
+            ret = std::max(ret, block_func(std::span<const rt_diti_t>(block)));
+          return ret;
+        }
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Merge the entries of new_heal_table into heal_table.  For edges in both tables, the heal_table entry is kept. */
+      static void nan_heal_table_merge(nan_heal_table_t& heal_table, const nan_heal_table_t& new_heal_table) {
+        std::size_t old_size = heal_table.size();
+        heal_table.insert(heal_table.end(), new_heal_table.begin(), new_heal_table.end());
+        std::inplace_merge(heal_table.begin(), heal_table.begin()+static_cast<std::ptrdiff_t>(old_size), heal_table.end(), nan_heal_less);
+        heal_table.erase(std::unique(heal_table.begin(), heal_table.end(), [](const nan_heal_t& a, const nan_heal_t& b) { return !(nan_heal_less(a, b) || nan_heal_less(b, a)); }),
+                         heal_table.end());
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Construct geometry for cells in batches of at most cell_block_size cells, and send each batch to writer.
+
+          Each batch is constructed in a fresh MR_cell_cplx with parallel_construct(), and then merged into writer with merge_ccplx().  The tree point to
+          writer node index map & the healed edge table live for the whole call, so each tree point & each healed edge is written once.
+
+          @param writer       Open stream writer
+          @param rtree        The MR_rect_tree with source data
+          @param cells        Cells to output from rtree
+          @param point_src    Point sources
+          @param func         Function used to heal broken edges (nullptr means no healing)
+          @param num_threads  Number of threads (zero means std::thread::hardware_concurrency())
+          @param build        Work function (See: parallel_construct())
+          @return Largest return from build() */
+      template<typename cells_range_t, typename build_t>
+      static int stream_construct(cc_stream_writer_t&  writer,
+                                  const rt_t&          rtree,
+                                  cells_range_t&&      cells,
+                                  const val_src_lst_t& point_src,
+                                  rt_drpt2rrpt_func_t  func,
+                                  int                  num_threads,
+                                  build_t&&            build
+                                 ) {
+        nan_heal_table_t heal_table;
+        node_cache_t     node_cache;
+        return for_each_cell_block(std::forward<cells_range_t>(cells), [&](std::span<const rt_diti_t> block) {
+          int ret = 0;
+          for(std::size_t begin=0; begin<block.size(); begin+=cell_block_size) {
+            std::span<const rt_diti_t> batch_cells = block.subspan(begin, std::min(cell_block_size, block.size()-begin));
+            cc_t             batch_ccplx;
+            nan_heal_table_t batch_heal_table;
+            node_cache_t     batch_node_cache;
+            create_dataset_to_point_mapping(rtree, batch_ccplx, point_src);
+            if (func) {
+              batch_heal_table = nan_heal_table(batch_ccplx, rtree, batch_cells, func, num_threads);
+              nan_heal_table_merge(heal_table, batch_heal_table);
+            }
+            ret = std::max(ret, parallel_construct(batch_ccplx, rtree, batch_cells, point_src, batch_heal_table, batch_node_cache, num_threads, build));
+            merge_ccplx(node_cache, heal_table, batch_ccplx, batch_node_cache, batch_heal_table,
+                        [&writer, &batch_ccplx](cc_node_idx_t batch_idx) { return writer.add_node(batch_ccplx, batch_idx); },
+                        [&writer](cc_cell_kind_t kind, cc_cell_verts_span_t verts) {
+                          if (std::none_of(verts.begin(), verts.end(), [](cc_node_idx_t v) { return v < 0; }))
+                            writer.add_cell(kind, verts);
+                        });
+          }
+          return ret;
+        });
+      }
       //@}
 
     public:
@@ -184,6 +836,9 @@ namespace mjr {
           Note we normally use this function when we detect a NaN in a geometric point (i.e. the things with a node_idx_t).  This solver solves until
           the return of func has no NaNs.  Those two criteria might not be the same thing, but it's OK.
 
+          This function keeps no state, so it may be used on several MR_cell_cplx & MR_rect_tree objects at once.  construct_geometry_fans() solves all the
+          edges it needs up front with nan_heal_table().
+
           @param ccplx                   The MR_cell_cplx to populate with geometry
           @param rtree                   The MR_rect_tree with source data
           @param good_point_ccplx_index  Good point index in the ccplx object
@@ -199,40 +854,74 @@ namespace mjr {
                                           rt_drpt2rrpt_func_t func,
                                           cc_uft_t            solver_epsilon=cc_t::epsilon/100
                                          ) {
-        // Solver cache.  Clear it if we have a different rtree object from last time.
-        static std::unordered_map<rt_diti_t, std::unordered_map<rt_diti_t, cc_node_idx_t>> nan_solver_cache;
-        static const rt_t* rtree_cache = nullptr;
-        if (rtree_cache != &rtree) {
-          nan_solver_cache.clear();
-          rtree_cache = &rtree;
-        }
-        // Check to see if we solved this one before
-        if (nan_solver_cache.contains(sick_point_rtree_index))
-          if (nan_solver_cache[sick_point_rtree_index].contains(good_point_rtree_index))
-            return  nan_solver_cache[sick_point_rtree_index][good_point_rtree_index];
-        // Apparently we need to solve this one as it's not in the case
-        rt_drpt_t good_point_drpt = rtree.diti_to_drpt(good_point_rtree_index);
-        rt_drpt_t sick_point_drpt = rtree.diti_to_drpt(sick_point_rtree_index);
-        rt_rrpt_t good_point_rrpt = rtree.get_sample(good_point_rtree_index);
-        rt_drpt_t init_point_drpt = good_point_drpt;
-        while ( (rtree.drpt_distance_inf(good_point_drpt, sick_point_drpt) > solver_epsilon) ) {
-          rt_drpt_t md_point_drpt = rtree.drpt_midpoint(good_point_drpt, sick_point_drpt);
-          rt_rrpt_t y = func(md_point_drpt);
-          if (rtree.rrpt_is_nan(y)) {
-            sick_point_drpt = md_point_drpt;
-          } else {
-            good_point_drpt = md_point_drpt;
-            good_point_rrpt = y;
-          }
-        }
-        // Figure out what to return, add it to the cache, and return.
-        cc_node_idx_t ret;
-        if (rtree.drpt_distance_inf(good_point_drpt, init_point_drpt) < (ccplx.epsilon)) // Use ccplx here!!!
-          ret = good_point_ccplx_index;
+        nan_heal_t heal = nan_edge_solve(rtree, good_point_rtree_index, sick_point_rtree_index, func, solver_epsilon);
+        if (heal.use_good)
+          return good_point_ccplx_index;
         else
-          ret = add_node(ccplx, good_point_drpt, good_point_rrpt);
-        nan_solver_cache[sick_point_rtree_index][good_point_rtree_index] = ret;
-        return ret;
+          return add_node(ccplx, heal.dom_pnt, heal.rng_pnt);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Solve every edge with one good point and one NaN point that construct_geometry_fans() will need to heal for the given cells.
+
+          The edges are solved with nan_edge_solver()'s algorithm, and the results are stored in a table sorted by edge.  The table belongs to the caller,
+          so nothing is shared between calls.  A table is only good for the rtree & ccplx objects it was built for.
+
+          ccplx is only used to identify NaN points -- i.e. ccplx must have the point mapping construct_geometry_fans() will use (point_src).
+
+          @param ccplx           The MR_cell_cplx that will be populated with geometry
+          @param rtree           The MR_rect_tree with source data
+          @param cells           List of cells to output from rtree
+          @param func            The function was used to sample the tree
+          @param num_threads     Number of threads used to solve edges (zero means std::thread::hardware_concurrency()).  func must be safe to call from
+                                 several threads at once when this is not 1.
+          @param solver_epsilon  Used as a distance threshold between sick point and solved endpoint in the tree domain space. */
+      static nan_heal_table_t nan_heal_table(const cc_t&                ccplx,
+                                             const rt_t&                rtree,
+                                             std::span<const rt_diti_t> cells,
+                                             rt_drpt2rrpt_func_t        func,
+                                             int                        num_threads=1,
+                                             cc_uft_t                   solver_epsilon=cc_t::epsilon/100
+                                            ) {
+        // Find broken edges -- each thread collects edges for a chunk of cells.
+        int real_num_threads = cc_t::parallel_for_threads(cells.size(), num_threads);
+        std::vector<std::vector<std::pair<rt_diti_t, rt_diti_t>>> thread_edges(static_cast<std::size_t>(real_num_threads));
+        cc_t::parallel_for(cells.size(), num_threads, [&](std::size_t begin, std::size_t end, int thread_idx) {
+          auto& edges = thread_edges[static_cast<std::size_t>(thread_idx)];
+          fan_stencil_t stencil;
+          for(std::size_t i=begin; i<end; ++i) {
+            rt_diti_t cell = cells[i];
+            if constexpr (rt_t::domain_dimension == 1) {
+              bool ctr_nan = node_is_nan(ccplx, rtree, cell);
+              for(auto& corner: rtree.ccc_get_corners(cell))
+                if (node_is_nan(ccplx, rtree, corner) != ctr_nan)
+                  edges.push_back(ctr_nan ? std::make_pair(cell, corner) : std::make_pair(corner, cell));
+            } else if constexpr (rt_t::domain_dimension == 2) {
+              fan_stencil(rtree, cell, stencil);
+              for(auto& face: stencil) {
+                std::array<rt_diti_t, 3> triangle = fan_triangle(face, cell);
+                std::array<bool, 3> tri_nan {node_is_nan(ccplx, rtree, triangle[0]), node_is_nan(ccplx, rtree, triangle[1]), node_is_nan(ccplx, rtree, triangle[2])};
+                for(int j=0; j<3; ++j)
+                  for(int k=0; k<3; ++k)
+                    if (tri_nan[j] && !tri_nan[k])
+                      edges.push_back(std::make_pair(triangle[j], triangle[k]));
+              }
+            }
+          }
+        });
+        // Sort & uniquify edges
+        nan_heal_table_t heal_table;
+        for(auto& edges: thread_edges)
+          for(auto& e: edges)
+            heal_table.push_back({e.first, e.second, rt_drpt_t(), rt_rrpt_t(), true, -2});
+        std::sort(heal_table.begin(), heal_table.end(), nan_heal_less);
+        heal_table.erase(std::unique(heal_table.begin(), heal_table.end(), [](const nan_heal_t& a, const nan_heal_t& b) { return !(nan_heal_less(a, b) || nan_heal_less(b, a)); }),
+                         heal_table.end());
+        // Solve edges
+        cc_t::parallel_for(heal_table.size(), num_threads, [&](std::size_t begin, std::size_t end, int) {
+          for(std::size_t i=begin; i<end; ++i)
+            heal_table[i] = nan_edge_solve(rtree, heal_table[i].good_diti, heal_table[i].sick_diti, func, solver_epsilon);
+        });
+        return heal_table;
       }
       //@}
 
@@ -256,165 +945,40 @@ namespace mjr {
           | FANS       |       3 |       3 | Solid Pyramids     |
           @endverbatim
 
+          Broken edges are found & solved before any geometry is constructed (See: nan_heal_table()).  Both the edge solve & the geometry construction
+          may be multithreaded.  For geometry construction the cells are split into chunks, each chunk is constructed in a thread local MR_cell_cplx, and
+          the results are merged into ccplx in order -- so the result does not depend on num_threads.
+
           @param ccplx             The MR_cell_cplx to populate with geometry
           @param rtree             The MR_rect_tree with source data
-          @param cells             List of cells to output from rtree
+          @param cells             Cells to output from rtree -- any range of rt_diti_t.  Contiguous ranges are used in place, other ranges
+                                   are traversed once & buffered in blocks.
           @param output_dimension  Parts of cells to output
           @param point_src         Point sources
-          @param func              The function was used to sample the tree */
+          @param func              The function was used to sample the tree
+          @param num_threads       Number of threads (zero means std::thread::hardware_concurrency()).  func must be safe to call from several threads
+                                   at once when this is not 1. */
+      template<typename cells_range_t>
+      requires (std::ranges::input_range<cells_range_t> && std::convertible_to<std::ranges::range_reference_t<cells_range_t>, rt_diti_t>)
       static int construct_geometry_fans(cc_t&               ccplx,
                                          const rt_t&         rtree,
-                                         rt_diti_list_t      cells,
+                                         cells_range_t&&     cells,
                                          int                 output_dimension,
                                          val_src_lst_t       point_src,
-                                         rt_drpt2rrpt_func_t func = nullptr
+                                         rt_drpt2rrpt_func_t func = nullptr,
+                                         int                 num_threads = 1
                                         ) {
         create_dataset_to_point_mapping(rtree, ccplx, point_src);
-        if (rtree.domain_dimension == 1) {
-          for(auto& cell: cells) {
-            cc_node_idx_t ctr_pnti = add_node(ccplx, rtree, cell);
-            rt_diti_list_t corners = rtree.ccc_get_corners(cell);
-            cc_node_idx_t cn0_pnti = add_node(ccplx, rtree, corners[0]);
-            cc_node_idx_t cn1_pnti = add_node(ccplx, rtree, corners[1]);
-            if (func) { // We have a func, so we can "heal" broken edges.
-              if (ctr_pnti < 0) { // Center: Broken. Left:
-                if(cn0_pnti >= 0) { // Center: Broken.  Left: Good.
-                  cc_node_idx_t np = nan_edge_solver(ccplx, rtree, cn0_pnti, corners[0], cell, func);
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {cn0_pnti, np}, output_dimension);
-                }
-                if(cn1_pnti >= 0) { // Center: Broken.  Right: Good.
-                  cc_node_idx_t np = nan_edge_solver(ccplx, rtree, cn1_pnti, corners[1], cell, func);
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {np, cn1_pnti}, output_dimension);
-                }
-              } else {             // Center: Good.
-                if(cn0_pnti < 0) { // Center: Good.  Left: Broken.
-                  cc_node_idx_t np = nan_edge_solver(ccplx, rtree, ctr_pnti, cell, corners[0], func);
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {np, ctr_pnti}, output_dimension);
-                } else {           // Center: Good.  Left: Good.
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {cn0_pnti, ctr_pnti}, output_dimension);
-                }
-                if(cn1_pnti < 0) { // Center: Good.  Right: Broken.
-                  cc_node_idx_t np = nan_edge_solver(ccplx, rtree, ctr_pnti, cell, corners[1], func);
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {ctr_pnti, np}, output_dimension);
-                } else {           // Center: Good.  Left: Good.
-                  ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {ctr_pnti, cn1_pnti}, output_dimension);
-                }
-              }
-            } else {
-              ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {cn0_pnti, ctr_pnti}, output_dimension);
-              ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {ctr_pnti, cn1_pnti}, output_dimension);
-            }
-          }
-        } else if (rtree.domain_dimension == 2) {
-          for(auto& cell: cells) {
-            if (func) { // We have a func, so we can "heal" broken edges.
-              for(int i=0; i<2; i++) {
-                for(int j=-1; j<2; j+=2) {
-                  std::vector<rt_diti_list_t> triangles;
-                  rt_diti_list_t nbrs = rtree.get_existing_neighbor(cell, i, j);
-                  if (nbrs.size() > 1) {
-                    for(auto n: nbrs) {
-                      rt_diti_list_t corners = rtree.ccc_get_corners(n, i, -j);
-                      if( ((i == 0) && (j == -1)) || ((i == 1) && (j == 1)) )
-                        triangles.push_back({corners[1], corners[0], cell});
-                      else
-                        triangles.push_back({corners[0], corners[1], cell});
-                    }
-                  } else {
-                    rt_diti_list_t corners = rtree.ccc_get_corners(cell, i, j);
-                    if( ((i == 0) && (j == -1)) || ((i == 1) && (j == 1)) )
-                      triangles.push_back({corners[1], corners[0], cell});
-                    else
-                      triangles.push_back({corners[0], corners[1], cell});
-                  }
-                  for(auto triangle: triangles) {
-                    std::array<cc_node_idx_t, 3> tpnts {add_node(ccplx, rtree, triangle[0]),
-                                                       add_node(ccplx, rtree, triangle[1]),
-                                                       add_node(ccplx, rtree, triangle[2])};
-                    int num_bad = static_cast<int>(std::count_if(tpnts.begin(), tpnts.end(), [](cc_node_idx_t i) { return i<0; }));
-                    if (num_bad == 0) {
-                      ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {tpnts[0], tpnts[1], tpnts[2]}, output_dimension);
-                    } else if ((num_bad == 1) || (num_bad == 2)) {
-                      // Rotate points so we only have two cases to think about...
-                      std::array<int, 3> p {0, 1, 2};
-                      if ( ((tpnts[1] < 0) && (num_bad == 1)) || ((tpnts[1] >= 0) && (num_bad == 2)) )
-                        p = {1, 2, 0};
-                      else if ( ((tpnts[2] < 0) && (num_bad == 1)) || ((tpnts[2] >= 0) && (num_bad == 2)) )
-                        p = {2, 0, 1};
-                      // Solve for edge 0-1 & 0-2
-                      if (num_bad == 1) {
-                        cc_node_idx_t np1 = nan_edge_solver(ccplx, rtree, tpnts[p[1]], triangle[p[1]], triangle[p[0]], func);
-                        cc_node_idx_t np2 = nan_edge_solver(ccplx, rtree, tpnts[p[2]], triangle[p[2]], triangle[p[0]], func);
-                        ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {np1, tpnts[p[1]], tpnts[p[2]]}, output_dimension);
-                        ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {tpnts[p[2]], np2, np1}, output_dimension);
-                      } else {
-                        cc_node_idx_t np1 = nan_edge_solver(ccplx, rtree, tpnts[p[0]], triangle[p[0]], triangle[p[1]], func);
-                        cc_node_idx_t np2 = nan_edge_solver(ccplx, rtree, tpnts[p[0]], triangle[p[0]], triangle[p[2]], func);
-                        ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {tpnts[p[0]], np1, np2}, output_dimension);
-                      }
-                    }
-                  }
-                }
-              }
-            } else { // We don't have a func, so we can can't "heal" broken edges.  This is much faster. ;)
-              cc_node_idx_t ctr_pnti = add_node(ccplx, rtree, cell);
-              if (ctr_pnti >= 0) { // Center point was good, let's try and make some triangles...
-                for(int i=0; i<2; i++) {
-                  for(int j=-1; j<2; j+=2) {
-                    rt_diti_list_t nbrs = rtree.get_existing_neighbor(cell, i, j);
-                    if (nbrs.size() > 1) {
-                      for(auto n: nbrs) {
-                        rt_diti_list_t corners = rtree.ccc_get_corners(n, i, -j);
-                        cc_node_idx_t cn0_pnti = add_node(ccplx, rtree, corners[0]);
-                        cc_node_idx_t cn1_pnti = add_node(ccplx, rtree, corners[1]);
-                        if( ((i == 0) && (j == -1)) || ((i == 1) && (j == 1)) )
-                          std::swap(cn0_pnti, cn1_pnti);
-                        ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {cn0_pnti, cn1_pnti, ctr_pnti}, output_dimension);
-                      }
-                    } else {
-                      rt_diti_list_t corners = rtree.ccc_get_corners(cell, i, j);
-                      cc_node_idx_t cn0_pnti = add_node(ccplx, rtree, corners[0]);
-                      cc_node_idx_t cn1_pnti = add_node(ccplx, rtree, corners[1]);
-                      if( ((i == 0) && (j == -1)) || ((i == 1) && (j == 1)) )
-                        std::swap(cn0_pnti, cn1_pnti);
-                      ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {cn0_pnti, cn1_pnti, ctr_pnti}, output_dimension);
-                    }
-                  }
-                }
-              }
-            }
-          }
-        } else if (rtree.domain_dimension == 3) {
-          for(auto& cell: cells) {
-            cc_node_idx_list_t new_cell(5);
-            new_cell[4] = add_node(ccplx, rtree, cell);
-            std::array<int, 5> p {0, 1, 3, 2, 4};
-            if (new_cell[4] >= 0) { // Center point was good, let's try and make some pyramids...
-              for(int dim=0; dim<3; dim++) {
-                for(int dir=-1; dir<2; dir+=2) {
-                  rt_diti_list_t nbrs = rtree.get_existing_neighbor(cell, dim, dir);
-                  if (nbrs.size() > 1) {
-                    for(auto n: nbrs) {
-                      rt_diti_list_t corners = rtree.ccc_get_corners(n, dim, -dir);
-                      for(int k=0; k<4; ++k)
-                        new_cell[p[k]] = add_node(ccplx, rtree, corners[k]);
-                      ccplx.add_cell(cc_t::cell_kind_t::PYRAMID, new_cell, output_dimension);
-                    }
-                  } else {
-                    rt_diti_list_t corners = rtree.ccc_get_corners(cell, dim, dir);
-                    for(int k=0; k<4; ++k)
-                      new_cell[p[k]] = add_node(ccplx, rtree, corners[k]);
-                    ccplx.add_cell(cc_t::cell_kind_t::PYRAMID, new_cell, output_dimension);
-                  }
-                }
-              }
-            }
-          }
-        } else { // if (rtree.domain_dimension > 3) {
-          std::cout << "ERROR: construct_geometry_fans: output_dimension>3 not supported for output_dimension>0!" << std::endl;
-          return 1;
-        }
-        return 0;
+        nan_heal_table_t heal_table;
+        node_cache_t     node_cache;
+        return for_each_cell_block(std::forward<cells_range_t>(cells), [&](std::span<const rt_diti_t> block) {
+          if (func)
+            nan_heal_table_merge(heal_table, nan_heal_table(ccplx, rtree, block, func, num_threads));
+          return parallel_construct(ccplx, rtree, block, point_src, heal_table, node_cache, num_threads,
+                                    [&rtree, output_dimension, &func](cc_t& cur_ccplx, std::span<const rt_diti_t> cur_cells, nan_heal_table_t& cur_heal_table, node_cache_t& cur_node_cache) {
+                                      return fans_to_ccplx(cur_ccplx, rtree, cur_cells, output_dimension, func, cur_heal_table, cur_node_cache);
+                                    });
+        });
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** @overload */
@@ -422,9 +986,10 @@ namespace mjr {
                                          const rt_t&         rtree,
                                          int                 output_dimension,
                                          val_src_lst_t       point_src,
-                                         rt_drpt2rrpt_func_t func = nullptr
+                                         rt_drpt2rrpt_func_t func = nullptr,
+                                         int                 num_threads = 1
                                         ) {
-        return construct_geometry_fans(ccplx, rtree, rtree.get_leaf_cells(), output_dimension, point_src, func);
+        return construct_geometry_fans(ccplx, rtree, rtree.get_leaf_cells(), output_dimension, point_src, func, num_threads);
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** Populate attached MR_cell_cplx object from data in attached MR_rect_tree object.
@@ -444,29 +1009,34 @@ namespace mjr {
 
           @param ccplx           The MR_cell_cplx to populate with geometry
           @param rtree           The MR_rect_tree with source data
-          @param cells           List of tree cells from which to construct geometry
+          @param cells           Tree cells from which to construct geometry -- any range of rt_diti_t.  The range is only traversed once.
           @param point_src       Point sources
           @param output_centers  Create vertexes for cell  centers
           @param output_corners  Create vertexes for cell corners*/
-      static int construct_geometry_points(cc_t&          ccplx,
-                                           const rt_t&    rtree,
-                                           rt_diti_list_t cells,
-                                           val_src_lst_t  point_src,
-                                           bool           output_centers,
-                                           bool           output_corners
+      template<typename cells_range_t>
+      requires (std::ranges::input_range<cells_range_t> && std::convertible_to<std::ranges::range_reference_t<cells_range_t>, rt_diti_t>)
+      static int construct_geometry_points(cc_t&           ccplx,
+                                           const rt_t&     rtree,
+                                           cells_range_t&& cells,
+                                           val_src_lst_t   point_src,
+                                           bool            output_centers,
+                                           bool            output_corners
                                           ) {
         create_dataset_to_point_mapping(rtree, ccplx, point_src);
+        node_cache_t node_cache;
+        if constexpr (std::ranges::sized_range<cells_range_t>)
+          node_cache_reserve(node_cache, static_cast<std::size_t>(std::ranges::size(cells)));
         if (output_centers && output_corners) {
-          for(auto& cell: cells)
+          for(auto&& cell: cells)
             for(auto& vert: rtree.ccc_get_vertexes(cell))
-              ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, vert)});
+              ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, vert, node_cache)});
         } else if (output_centers) {
-          for(auto& cell: cells)
-            ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, cell)});
+          for(auto&& cell: cells)
+            ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, cell, node_cache)});
         } else if (output_corners) {
-          for(auto& cell: cells)
+          for(auto&& cell: cells)
             for(auto& vert: rtree.ccc_get_corners(cell))
-              ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, vert)});
+              ccplx.add_cell(cc_t::cell_kind_t::POINT, {add_node(ccplx, rtree, vert, node_cache)});
         } else {
           std::cout << "WARNING: construct_geometry_points: Both output_centers & output_corners are FALSE.  No geometry created!" << std::endl;
           return 1;
@@ -500,46 +1070,32 @@ namespace mjr {
 
           @param ccplx                The MR_cell_cplx to populate with geometry
           @param rtree                The MR_rect_tree with source data
-          @param cells                List of tree cells from which to construct geometry
+          @param cells                Tree cells from which to construct geometry -- any range of rt_diti_t.  Contiguous ranges are used in place, other
+                                      ranges are traversed once & buffered in blocks.
           @param output_dimension     Parts of cells to output
           @param point_src            Point sources
-          @param degenerate_fallback  If the rectangle is degenerate, try and make a triangle. (only works for cc_t::cell_kind_t::QUAD) */
-      static int construct_geometry_rects(cc_t&          ccplx,
-                                          const rt_t&    rtree,
-                                          rt_diti_list_t cells,
-                                          int            output_dimension,
-                                          val_src_lst_t  point_src,
-                                          bool           degenerate_fallback = true
+          @param degenerate_fallback  If the rectangle is degenerate, try and make a triangle. (only works for cc_t::cell_kind_t::QUAD)
+          @param num_threads          Number of threads (zero means std::thread::hardware_concurrency()).  As with construct_geometry_fans(), the result
+                                      does not depend on num_threads. */
+      template<typename cells_range_t>
+      requires (std::ranges::input_range<cells_range_t> && std::convertible_to<std::ranges::range_reference_t<cells_range_t>, rt_diti_t>)
+      static int construct_geometry_rects(cc_t&           ccplx,
+                                          const rt_t&     rtree,
+                                          cells_range_t&& cells,
+                                          int             output_dimension,
+                                          val_src_lst_t   point_src,
+                                          bool            degenerate_fallback = true,
+                                          int             num_threads = 1
                                          ) {
         create_dataset_to_point_mapping(rtree, ccplx, point_src);
-        for(auto& cell: cells) {
-          std::vector<cc_node_idx_t> cnr_pti;
-          rt_diti_list_t corners = rtree.ccc_get_corners(cell);
-          for(auto& corner: corners) {
-            cc_node_idx_t pnti = add_node(ccplx, rtree, corner);
-            cnr_pti.push_back(pnti);
-          }
-          if (rtree.domain_dimension == 1) {
-            ccplx.add_cell(cc_t::cell_kind_t::SEGMENT, {cnr_pti[0], cnr_pti[1]}, output_dimension);
-          } else if (rtree.domain_dimension == 2) {
-            const std::array<int, 4> p = {0, 1, 3, 2};
-            bool try_harder = !(ccplx.add_cell(cc_t::cell_kind_t::QUAD, {cnr_pti[0], cnr_pti[1], cnr_pti[3], cnr_pti[2]}, output_dimension));
-            if ( degenerate_fallback && try_harder) { // Try for a triangle if we have a NaN point or an adjacent pair of duplicate points
-              for(int i=0; i<4; i++) {
-                if ((cnr_pti[p[i]] < 0) || (cnr_pti[p[(i+0)%4]] == cnr_pti[p[(i+1)%4]])) {
-                  ccplx.add_cell(cc_t::cell_kind_t::TRIANGLE, {cnr_pti[p[(i+1)%4]], cnr_pti[p[(i+2)%4]], cnr_pti[p[(i+3)%4]]}, output_dimension);
-                  break;
-                }
-              }
-            }
-          } else { // if(rtree.domain_dimension == 3) {
-            ccplx.add_cell(cc_t::cell_kind_t::HEXAHEDRON,
-                           {cnr_pti[0], cnr_pti[1], cnr_pti[3], cnr_pti[2],
-                            cnr_pti[4], cnr_pti[5], cnr_pti[7], cnr_pti[6]},
-                           output_dimension);
-          }
-        }
-        return 0;
+        nan_heal_table_t heal_table;
+        node_cache_t     node_cache;
+        return for_each_cell_block(std::forward<cells_range_t>(cells), [&](std::span<const rt_diti_t> block) {
+          return parallel_construct(ccplx, rtree, block, point_src, heal_table, node_cache, num_threads,
+                                    [&rtree, output_dimension, degenerate_fallback](cc_t& cur_ccplx, std::span<const rt_diti_t> cur_cells, nan_heal_table_t&, node_cache_t& cur_node_cache) {
+                                      return rects_to_ccplx(cur_ccplx, rtree, cur_cells, output_dimension, degenerate_fallback, cur_node_cache);
+                                    });
+        });
       }
       //--------------------------------------------------------------------------------------------------------------------------------------------------------
       /** @overload */
@@ -547,9 +1103,185 @@ namespace mjr {
                                           const rt_t&   rtree,
                                           int           output_dimension,
                                           val_src_lst_t point_src,
-                                          bool          degenerate_fallback = true
+                                          bool          degenerate_fallback = true,
+                                          int           num_threads = 1
                                          ) {
-        return construct_geometry_rects(ccplx, rtree, rtree.get_leaf_cells(), output_dimension, point_src, degenerate_fallback);
+        return construct_geometry_rects(ccplx, rtree, rtree.get_leaf_cells(), output_dimension, point_src, degenerate_fallback, num_threads);
+      }
+      //@}
+
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Incremental poly data construction */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Bring a MR_cell_cplx object populated by earlier calls up to date with a MR_rect_tree that has been refined since the last call.
+
+          After each call ccplx holds the same set of cells as construct_geometry_fans() would produce for the tree, but not necessarily in the same order
+          or with the same node indexes -- leaf cells are processed in sorted order, one at a time.  Each call compares the current leaf cells with the
+          leaf cells seen by the last call (none for a fresh bridge_state_t), and only touches geometry for:
+            - Leaf cells that are new (created by refinement)
+            - Leaf cells that are gone (refined, and now have children)
+            - Leaf cells across a face from one of the above.  Fans use the corners of smaller neighbors, so these must be rebuilt too.  When
+              output_dimension is less than the domain dimension minus one, neighbors of these neighbors are also rebuilt.
+          The cells produced by gone & rebuilt leaf cells are removed (See: MR_cell_cplx::cull_cells_by_index()), and then cells for new & rebuilt
+          leaf cells are added.  Node indexes are never changed -- nodes for tree points & healed edges are created once, and reused by later calls.  Nodes
+          only used by removed cells remain in ccplx.  The cost of an update is proportional to the number of leaf cells touched, plus a pass over the leaf
+          cell list & the cells of ccplx.
+
+          Geometry is always constructed with one thread.  Edge healing uses num_threads threads (See: nan_heal_table()).
+
+          @param ccplx             The MR_cell_cplx to update.  It must only be modified by update_geometry_fans().
+          @param state             Bridge state for ccplx
+          @param rtree             The MR_rect_tree with source data
+          @param output_dimension  Parts of cells to output.  Must not change between calls.
+          @param point_src         Point sources.  Must not change between calls.
+          @param func              The function was used to sample the tree
+          @param num_threads       Number of threads (zero means std::thread::hardware_concurrency()) */
+      static int update_geometry_fans(cc_t&               ccplx,
+                                      bridge_state_t&     state,
+                                      const rt_t&         rtree,
+                                      int                 output_dimension,
+                                      val_src_lst_t       point_src,
+                                      rt_drpt2rrpt_func_t func = nullptr,
+                                      int                 num_threads = 1
+                                     ) {
+        if (state.leaves.empty())
+          create_dataset_to_point_mapping(rtree, ccplx, point_src);
+        // Find new & gone leaf cells
+        rt_diti_list_t leaves = rtree.get_leaf_cells();
+        std::sort(leaves.begin(), leaves.end());
+        rt_diti_list_t new_leaves, gone_leaves;
+        std::set_difference(leaves.begin(), leaves.end(), state.leaves.begin(), state.leaves.end(), std::back_inserter(new_leaves));
+        std::set_difference(state.leaves.begin(), state.leaves.end(), leaves.begin(), leaves.end(), std::back_inserter(gone_leaves));
+        // Find old leaf cells with a new or gone neighbor.  When lower dimensional parts of cells are output, cells sharing an edge or corner may
+        // produce the same cell (only one copy is kept), so neighbors of neighbors are rebuilt too.
+        rt_diti_list_t nbr_leaves;
+        for(auto& changed_leaves: {&new_leaves, &gone_leaves})
+          for(auto& cell: *changed_leaves)
+            for(auto& nbr: face_neighbors(rtree, cell))
+              nbr_leaves.push_back(nbr);
+        if (output_dimension < rt_t::domain_dimension - 1) {
+          std::size_t num_nbr_leaves = nbr_leaves.size();
+          for(std::size_t i=0; i<num_nbr_leaves; ++i)
+            for(auto& nbr: face_neighbors(rtree, nbr_leaves[i]))
+              nbr_leaves.push_back(nbr);
+        }
+        rt_diti_list_t dirty_leaves;
+        for(auto& nbr: nbr_leaves)
+          if (std::binary_search(state.leaves.begin(), state.leaves.end(), nbr) && std::binary_search(leaves.begin(), leaves.end(), nbr))
+            dirty_leaves.push_back(nbr);
+        std::sort(dirty_leaves.begin(), dirty_leaves.end());
+        dirty_leaves.erase(std::unique(dirty_leaves.begin(), dirty_leaves.end()), dirty_leaves.end());
+        // Remove cells from gone & dirty leaf cells
+        rt_diti_list_t retire_leaves;
+        std::set_union(gone_leaves.begin(), gone_leaves.end(), dirty_leaves.begin(), dirty_leaves.end(), std::back_inserter(retire_leaves));
+        if ( !(retire_leaves.empty())) {
+          auto retire_cell = [&state, &retire_leaves](int cell_idx) {
+            return std::binary_search(retire_leaves.begin(), retire_leaves.end(), state.cell_owner[static_cast<std::size_t>(cell_idx)]);
+          };
+          ccplx.cull_cells_by_index(retire_cell);
+          state.cell_owner.erase(std::remove_if(state.cell_owner.begin(), state.cell_owner.end(),
+                                                [&retire_leaves](rt_diti_t owner) { return std::binary_search(retire_leaves.begin(), retire_leaves.end(), owner); }),
+                                 state.cell_owner.end());
+        }
+        // Add cells for new & dirty leaf cells
+        rt_diti_list_t build_leaves;
+        std::set_union(new_leaves.begin(), new_leaves.end(), dirty_leaves.begin(), dirty_leaves.end(), std::back_inserter(build_leaves));
+        if (func)
+          nan_heal_table_merge(state.heal_table, nan_heal_table(ccplx, rtree, build_leaves, func, num_threads));
+        int ret = 0;
+        for(auto& cell: build_leaves) {
+          ret = std::max(ret, fans_to_ccplx(ccplx, rtree, std::span<const rt_diti_t>(&cell, 1), output_dimension, func, state.heal_table, state.node_cache));
+          state.cell_owner.resize(static_cast<std::size_t>(ccplx.num_cells()), cell);
+        }
+        state.leaves = std::move(leaves);
+        return ret;
+      }
+      //@}
+
+      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      /** @name Streaming poly data construction
+
+          These methods produce the same geometry as construct_geometry_fans() & construct_geometry_rects(), but send it to an open
+          MR_cell_cplx::stream_writer_t instead of a MR_cell_cplx.  Cells are processed in batches of cell_block_size cells, and only one batch is held in
+          memory at a time.  Node indexes in the file are assigned as nodes are written, and tree points are mapped to file node indexes with the same tree
+          point map used by construct_geometry_fans() -- so memory use grows with the number of tree points, not with the geometry.
+
+          Unlike a MR_cell_cplx, the writer does not merge geometrically identical nodes from different batches (nodes from the same tree point are always
+          merged), and it does not remove duplicate cells from different batches.  With less than cell_block_size cells the file is identical to the one
+          produced by construct_geometry_*() followed by the corresponding MR_cell_cplx::write_*() method -- except when cc_t does not check cell
+          vertexes (chk_cell_vertexes is false).  Then cells with a NaN point (a negative vertex) are kept in a MR_cell_cplx, but are never written by the
+          stream writer. */
+      //@{
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Stream the geometry construct_geometry_fans() would produce to writer.
+          @param writer            Open stream writer
+          @param rtree             The MR_rect_tree with source data
+          @param cells             Cells to output from rtree -- any range of rt_diti_t.
+          @param output_dimension  Parts of cells to output
+          @param point_src         Point sources
+          @param func              The function was used to sample the tree
+          @param num_threads       Number of threads (zero means std::thread::hardware_concurrency()) */
+      template<typename cells_range_t>
+      requires (std::ranges::input_range<cells_range_t> && std::convertible_to<std::ranges::range_reference_t<cells_range_t>, rt_diti_t>)
+      static int stream_geometry_fans(cc_stream_writer_t& writer,
+                                      const rt_t&         rtree,
+                                      cells_range_t&&     cells,
+                                      int                 output_dimension,
+                                      val_src_lst_t       point_src,
+                                      rt_drpt2rrpt_func_t func = nullptr,
+                                      int                 num_threads = 1
+                                     ) {
+        return stream_construct(writer, rtree, std::forward<cells_range_t>(cells), point_src, func, num_threads,
+                                [&rtree, output_dimension, &func](cc_t& cur_ccplx, std::span<const rt_diti_t> cur_cells, nan_heal_table_t& cur_heal_table, node_cache_t& cur_node_cache) {
+                                  return fans_to_ccplx(cur_ccplx, rtree, cur_cells, output_dimension, func, cur_heal_table, cur_node_cache);
+                                });
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload */
+      static int stream_geometry_fans(cc_stream_writer_t& writer,
+                                      const rt_t&         rtree,
+                                      int                 output_dimension,
+                                      val_src_lst_t       point_src,
+                                      rt_drpt2rrpt_func_t func = nullptr,
+                                      int                 num_threads = 1
+                                     ) {
+        return stream_geometry_fans(writer, rtree, rtree.get_leaf_cells(), output_dimension, point_src, func, num_threads);
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** Stream the geometry construct_geometry_rects() would produce to writer.
+          @param writer               Open stream writer
+          @param rtree                The MR_rect_tree with source data
+          @param cells                Cells to output from rtree -- any range of rt_diti_t.
+          @param output_dimension     Parts of cells to output
+          @param point_src            Point sources
+          @param degenerate_fallback  If the rectangle is degenerate, try and make a triangle. (only works for cc_t::cell_kind_t::QUAD)
+          @param num_threads          Number of threads (zero means std::thread::hardware_concurrency()) */
+      template<typename cells_range_t>
+      requires (std::ranges::input_range<cells_range_t> && std::convertible_to<std::ranges::range_reference_t<cells_range_t>, rt_diti_t>)
+      static int stream_geometry_rects(cc_stream_writer_t& writer,
+                                       const rt_t&         rtree,
+                                       cells_range_t&&     cells,
+                                       int                 output_dimension,
+                                       val_src_lst_t       point_src,
+                                       bool                degenerate_fallback = true,
+                                       int                 num_threads = 1
+                                      ) {
+        return stream_construct(writer, rtree, std::forward<cells_range_t>(cells), point_src, nullptr, num_threads,
+                                [&rtree, output_dimension, degenerate_fallback](cc_t& cur_ccplx, std::span<const rt_diti_t> cur_cells, nan_heal_table_t&, node_cache_t& cur_node_cache) {
+                                  return rects_to_ccplx(cur_ccplx, rtree, cur_cells, output_dimension, degenerate_fallback, cur_node_cache);
+                                });
+      }
+      //--------------------------------------------------------------------------------------------------------------------------------------------------------
+      /** @overload */
+      static int stream_geometry_rects(cc_stream_writer_t& writer,
+                                       const rt_t&         rtree,
+                                       int                 output_dimension,
+                                       val_src_lst_t       point_src,
+                                       bool                degenerate_fallback = true,
+                                       int                 num_threads = 1
+                                      ) {
+        return stream_geometry_rects(writer, rtree, rtree.get_leaf_cells(), output_dimension, point_src, degenerate_fallback, num_threads);
       }
       //@}
 
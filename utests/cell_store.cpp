@@ -0,0 +1,570 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      cell_store.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @brief     Unit tests for MR_cell_cplx.@EOL
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Main
+#include <boost/test/unit_test.hpp>
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "MR_cell_cplx.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <set>
+#include <sstream>
+#include <utility>
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(cell_store) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+
+  aPoly.add_node({0.0, 0.0, 0.0}); // 0
+  aPoly.add_node({1.0, 0.0, 0.0}); // 1
+  aPoly.add_node({1.0, 1.0, 0.0}); // 2
+  aPoly.add_node({0.0, 1.0, 0.0}); // 3
+  aPoly.add_node({0.0, 0.0, 1.0}); // 4
+
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::SEGMENT,  {0, 1}));
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 1, 2}));
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::QUAD,     {0, 1, 2, 3}));
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::PYRAMID,  {0, 1, 2, 3, 4}));
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::POINT,    {4}));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  BOOST_CHECK(aPoly.num_cells() == 5);
+
+  BOOST_CHECK(aPoly.get_cell_kind(0) == cc_t::cell_kind_t::SEGMENT);
+  BOOST_CHECK(aPoly.get_cell_kind(3) == cc_t::cell_kind_t::PYRAMID);
+  BOOST_CHECK(aPoly.get_cell_kind(4) == cc_t::cell_kind_t::POINT);
+
+  BOOST_CHECK(aPoly.get_cell_verts(0).size() == 2);
+  BOOST_CHECK(aPoly.get_cell_verts(3).size() == 5);
+  BOOST_CHECK(aPoly.get_cell_verts(3)[4] == 4);
+  BOOST_CHECK(aPoly.get_cell_verts(4)[0] == 4);
+
+  BOOST_CHECK(aPoly.cell_kind_to_vtk_type(cc_t::cell_kind_t::QUAD)       ==  9);
+  BOOST_CHECK(aPoly.cell_kind_to_vtk_type(cc_t::cell_kind_t::HEXAHEDRON) == 12);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  BOOST_CHECK(aPoly.cull_cells([](cc_t::cell_verts_t c){ return (c.size() == 3) || (c.size() == 5); }) == 2);
+
+  BOOST_CHECK(aPoly.num_cells() == 3);
+
+  BOOST_CHECK(aPoly.get_cell_kind(0) == cc_t::cell_kind_t::SEGMENT);
+  BOOST_CHECK(aPoly.get_cell_kind(1) == cc_t::cell_kind_t::QUAD);
+  BOOST_CHECK(aPoly.get_cell_kind(2) == cc_t::cell_kind_t::POINT);
+
+  BOOST_CHECK(aPoly.get_cell_verts(1).size() == 4);
+  BOOST_CHECK(aPoly.get_cell_verts(1)[3] == 3);
+  BOOST_CHECK(aPoly.get_cell_verts(2).size() == 1);
+  BOOST_CHECK(aPoly.get_cell_verts(2)[0] == 4);
+
+  BOOST_CHECK(aPoly.cell_below_level(aPoly.get_cell_verts(1), 2, 0.5) == true);
+  BOOST_CHECK(aPoly.cell_below_level(aPoly.get_cell_verts(2), 2, 0.5) == false);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  aPoly.clear();
+  BOOST_CHECK(aPoly.num_cells() == 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(cell_unique) {
+
+  typedef mjr::MR_cell_cplx<false, true, false, false, false, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+
+  std::mt19937 rEng(42);
+  std::uniform_int_distribution<int> vDist(0, 40);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Random triangles & quads checked against a std::set of sorted vertex lists
+
+  std::set<cc_t::cell_verts_t> ref_set;
+  for(int i=0; i<20000; i++) {
+    cc_t::cell_verts_t c = {vDist(rEng), vDist(rEng), vDist(rEng)};
+    if (i%3 == 0)
+      c.push_back(vDist(rEng));
+    cc_t::cell_verts_t cs = c;
+    std::sort(cs.begin(), cs.end());
+    bool is_new = !(ref_set.contains(cs));
+    ref_set.insert(cs);
+    BOOST_CHECK(aPoly.add_cell(c.size() == 3 ? cc_t::cell_kind_t::TRIANGLE : cc_t::cell_kind_t::QUAD, c));
+    BOOST_CHECK(aPoly.last_cell_added_was_new() == is_new);
+  }
+  BOOST_CHECK(aPoly.num_cells() == static_cast<int>(ref_set.size()));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Culled cells leave the index, and may be added again
+
+  int num_culled = aPoly.cull_cells([](cc_t::cell_verts_t c){ return (c[0] % 2) == 0; });
+  BOOST_CHECK(num_culled > 0);
+  int num_readded = 0;
+  for(const auto& c: ref_set) {
+    aPoly.add_cell(c.size() == 3 ? cc_t::cell_kind_t::TRIANGLE : cc_t::cell_kind_t::QUAD, c);
+    if (aPoly.last_cell_added_was_new())
+      num_readded++;
+  }
+  BOOST_CHECK(num_readded == num_culled);
+  BOOST_CHECK(aPoly.num_cells() == static_cast<int>(ref_set.size()));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Culling by index keeps the order of the remaining cells
+
+  int num_start = aPoly.num_cells();
+  cc_t::cell_verts_t cell3(aPoly.get_cell_verts(3).begin(), aPoly.get_cell_verts(3).end());
+  BOOST_CHECK(aPoly.cull_cells_by_index([](int i){ return (i % 3) != 0; }) == num_start - (num_start+2)/3);
+  BOOST_CHECK(std::ranges::equal(aPoly.get_cell_verts(1), cell3));
+  aPoly.add_cell(cell3.size() == 3 ? cc_t::cell_kind_t::TRIANGLE : cc_t::cell_kind_t::QUAD, cell3);
+  BOOST_CHECK( !(aPoly.last_cell_added_was_new()));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Without vertex checks cells may have negative vertexes.  They are indexed like any other cell.
+
+  num_start = aPoly.num_cells();
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {-1, 2, 3}));
+  BOOST_CHECK(aPoly.last_cell_added_was_new());
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {3, -1, 2}));
+  BOOST_CHECK( !(aPoly.last_cell_added_was_new()));
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::SEGMENT, {-1, -2}));
+  BOOST_CHECK(aPoly.last_cell_added_was_new());
+  BOOST_CHECK(aPoly.num_cells() == num_start + 2);
+  BOOST_CHECK(aPoly.cull_cells([](cc_t::cell_verts_t c){ return c[0] < 0; }) == 2);
+  BOOST_CHECK(aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {2, 3, -1}));
+  BOOST_CHECK(aPoly.last_cell_added_was_new());
+  BOOST_CHECK(aPoly.num_cells() == num_start + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(batch_add) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::vector<cc_t::node_data_t> nodes = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 1.0, 0.0}};
+  cc_t::node_idx_list_t node_idxs = aPoly.add_nodes(nodes);
+
+  BOOST_CHECK(node_idxs == cc_t::node_idx_list_t({0, 1, 2, 0, 3}));
+  BOOST_CHECK(aPoly.node_count() == 4);
+
+  std::vector<double> flat_nodes = {2.0, 0.0, 0.0,  1.0, 1.0, 0.0,  2.0, 1.0, 0.0};
+  BOOST_CHECK(aPoly.add_nodes(flat_nodes, 3) == cc_t::node_idx_list_t({4, 2, 5}));
+  BOOST_CHECK(aPoly.add_nodes(flat_nodes, 2).empty());
+  BOOST_CHECK(aPoly.node_count() == 6);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::vector<cc_t::cell_stat_t> stats = aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3,  0, 1, 1,  2, 1, 0}));
+
+  BOOST_CHECK(stats.size() == 4);
+  BOOST_CHECK(stats[0] == cc_t::cell_stat_t::GOOD);
+  BOOST_CHECK(stats[1] == cc_t::cell_stat_t::GOOD);
+  BOOST_CHECK(stats[2] == cc_t::cell_stat_t::DUP_PNT);
+  BOOST_CHECK(stats[3] == cc_t::cell_stat_t::GOOD);
+  BOOST_CHECK(aPoly.num_cells() == 2);
+  BOOST_CHECK(aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1})).empty());
+
+  std::vector<cc_t::cell_kind_t> kinds = {cc_t::cell_kind_t::SEGMENT, cc_t::cell_kind_t::QUAD};
+  stats = aPoly.add_cells(kinds, cc_t::node_idx_list_t({1, 4,  1, 4, 5, 2}));
+
+  BOOST_CHECK(stats.size() == 2);
+  BOOST_CHECK(stats[0] == cc_t::cell_stat_t::GOOD);
+  BOOST_CHECK(stats[1] == cc_t::cell_stat_t::GOOD);
+  BOOST_CHECK(aPoly.num_cells() == 4);
+  BOOST_CHECK(aPoly.get_cell_kind(3) == cc_t::cell_kind_t::QUAD);
+  BOOST_CHECK(aPoly.get_cell_verts(3)[2] == 5);
+  BOOST_CHECK(aPoly.add_cells(kinds, cc_t::node_idx_list_t({1, 4,  1, 4, 5})).empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(append) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+  cc_t bPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}}));
+  aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3}));
+  aPoly.create_named_datasets({"x", "y", "z"});
+
+  // bPoly shares an edge (1,0,0)-(1,1,0) & a triangle with aPoly.  (1,0,0) is off by less than eps.
+  bPoly.add_nodes(std::vector<cc_t::node_data_t>({{2.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {1.000001, 0.0, 0.0}, {2.0, 1.0, 0.0}, {0.0, 0.0, 0.0}}));
+  bPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({2, 0, 1,  0, 3, 1,  4, 2, 1}));
+  bPoly.create_named_datasets({"x", "y", "z", "w"});
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  cc_t::node_idx_list_t node_remap = aPoly.append(bPoly);
+
+  BOOST_CHECK(node_remap == cc_t::node_idx_list_t({4, 2, 1, 5, 0}));
+  BOOST_CHECK(aPoly.node_count() == 6);
+  BOOST_CHECK(aPoly.num_cells() == 4);
+  BOOST_CHECK(aPoly.get_cell_verts(2)[0] == 1);
+  BOOST_CHECK(aPoly.get_cell_verts(2)[1] == 4);
+  BOOST_CHECK(aPoly.get_cell_verts(3)[1] == 5);
+  BOOST_CHECK(aPoly.named_datasets_count() == 4);
+
+  // New nodes far from the old ones must still be found by add_node()
+  BOOST_CHECK(aPoly.add_node({2.0, 1.0, 0.0}) == 5);
+
+  // Appending a complex to itself adds nothing new
+  BOOST_CHECK(aPoly.append(aPoly) == cc_t::node_idx_list_t({0, 1, 2, 3, 4, 5}));
+  BOOST_CHECK(aPoly.node_count() == 6);
+  BOOST_CHECK(aPoly.num_cells() == 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(append_unchecked) {
+
+  typedef mjr::MR_cell_cplx<true, false, false, false, false, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+  cc_t bPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}}));
+  aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 1, 2});
+
+  // With vertex checks off, bPoly can hold cells that can't be appended
+  bPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {2.0, 0.0, 0.0}}));
+  BOOST_CHECK(bPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 1, 2}));                        // Good
+  BOOST_CHECK(bPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, -1, 2}));                       // Negative vertex
+  BOOST_CHECK(bPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 1, 4}));                        // Vertex past the last node
+  BOOST_CHECK(bPoly.add_cell(cc_t::cell_kind_t::HEXAHEDRON, {0, 1, 2, 3, 0, 1, 2, 3, 0}));    // Nine vertexes
+  BOOST_CHECK(bPoly.add_cell(cc_t::cell_kind_t::SEGMENT, {3, 0}));                            // Good
+  BOOST_CHECK(bPoly.num_cells() == 5);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  BOOST_CHECK(aPoly.append(bPoly) == cc_t::node_idx_list_t({0, 2, 3, 4}));
+  BOOST_CHECK(aPoly.node_count() == 5);
+  BOOST_CHECK(aPoly.num_cells() == 3);
+  BOOST_CHECK(aPoly.get_cell_kind(1) == cc_t::cell_kind_t::TRIANGLE);
+  BOOST_CHECK(aPoly.get_cell_verts(1)[2] == 3);
+  BOOST_CHECK(aPoly.get_cell_kind(2) == cc_t::cell_kind_t::SEGMENT);
+  BOOST_CHECK(aPoly.get_cell_verts(2)[0] == 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(stream_writer) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  auto slurp = [](std::string file_name) { std::ifstream in_stream(file_name); std::stringstream ss; ss << in_stream.rdbuf(); return ss.str(); };
+
+  cc_t aPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {2.0, 1.0/3.0, 0.0}}));
+  aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3}));
+  aPoly.add_cell(cc_t::cell_kind_t::QUAD, {1, 4, 2, 3});
+  aPoly.create_named_datasets({"x", "y"}, {{"NORMALS", {0, 1, 2}}});
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  for(auto [format, precision]: {std::pair(cc_t::stream_format_t::XML_VTK, 10), std::pair(cc_t::stream_format_t::PLY, 10),
+                                 std::pair(cc_t::stream_format_t::XML_VTK,  3), std::pair(cc_t::stream_format_t::PLY,  3)}) {
+    std::string ext = (format == cc_t::stream_format_t::PLY ? ".ply" : ".vtu");
+    aPoly.set_ascii_precision(precision);
+    if (format == cc_t::stream_format_t::PLY)
+      aPoly.write_ply("utest_stream_writer_a" + ext, "stream_writer");
+    else
+      aPoly.write_xml_vtk("utest_stream_writer_a" + ext, "stream_writer");
+
+    // Nodes are sent in two batches, and are renumbered in the order they are written
+    cc_t::stream_writer_t writer;
+    BOOST_CHECK(writer.open("utest_stream_writer_b" + ext, "stream_writer", format, aPoly.get_data_name_to_data_idx_lst()) == 0);
+    writer.set_ascii_precision(precision);
+    BOOST_CHECK(writer.add_node(aPoly, 0) == 0);
+    BOOST_CHECK(writer.add_node(aPoly, 1) == 1);
+    BOOST_CHECK(writer.add_node(aPoly, 2) == 2);
+    BOOST_CHECK(writer.add_cell(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2})));
+    BOOST_CHECK( !(writer.add_cell(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 2, 3}))));
+    BOOST_CHECK(writer.add_node(aPoly, 3) == 3);
+    BOOST_CHECK(writer.add_node(aPoly, 4) == 4);
+    BOOST_CHECK(writer.add_cell(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 2, 3})));
+    BOOST_CHECK(writer.add_cell(cc_t::cell_kind_t::QUAD, cc_t::node_idx_list_t({1, 4, 2, 3})));
+    BOOST_CHECK(writer.node_count() == 5);
+    BOOST_CHECK(writer.num_cells() == 3);
+    BOOST_CHECK(writer.close() == 0);
+    BOOST_CHECK( !(writer.is_open()));
+
+    BOOST_CHECK(slurp("utest_stream_writer_a" + ext) == slurp("utest_stream_writer_b" + ext));
+    BOOST_CHECK(slurp("utest_stream_writer_b" + ext).contains("0.3333333333") == (precision == 10));
+    BOOST_CHECK(slurp("utest_stream_writer_b" + ext).contains("0.333 ")       == (precision == 3));
+  }
+
+  // Errors are reported by close(), and the temporary files are removed
+  cc_t::stream_writer_t writer;
+  BOOST_CHECK(writer.open("utest_stream_writer_c.ply", "stream_writer", cc_t::stream_format_t::PLY) == 0);
+  writer.add_node(aPoly, 0);
+  writer.add_node(aPoly, 1);
+  writer.add_cell(cc_t::cell_kind_t::SEGMENT, cc_t::node_idx_list_t({0, 1}));
+  BOOST_CHECK(writer.close() == 2);
+  BOOST_CHECK( !(std::ifstream("utest_stream_writer_c.ply.part0").good()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(xml_vtk_binary) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  auto slurp = [](std::string file_name) { std::ifstream in_stream(file_name, std::ios::binary); std::stringstream ss; ss << in_stream.rdbuf(); return ss.str(); };
+  auto b64   = [](std::string a, std::string b) {
+    std::ostringstream ss;
+    cc_t::write_base64(ss, {std::span<const unsigned char>(reinterpret_cast<const unsigned char*>(a.data()), a.size()),
+                            std::span<const unsigned char>(reinterpret_cast<const unsigned char*>(b.data()), b.size())});
+    return ss.str();
+  };
+
+  // Standard test vectors.  Spans are encoded as a single sequence.
+  BOOST_CHECK(b64("", "")              == "");
+  BOOST_CHECK(b64("M", "")             == "TQ==");
+  BOOST_CHECK(b64("Ma", "")            == "TWE=");
+  BOOST_CHECK(b64("Man", "")           == "TWFu");
+  BOOST_CHECK(b64("foobar", "")        == "Zm9vYmFy");
+  BOOST_CHECK(b64("f", "oobar")        == "Zm9vYmFy");
+  BOOST_CHECK(b64("foob", "ar")        == "Zm9vYmFy");
+  BOOST_CHECK(b64("fo", "ob")          == "Zm9vYg==");
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  cc_t aPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {2.0, 0.5, 0.0}}));
+  aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3}));
+  aPoly.add_cell(cc_t::cell_kind_t::QUAD, {1, 4, 2, 3});
+  aPoly.create_named_datasets({"x", "y"}, {{"NORMALS", {0, 1, 2}}});
+
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_b.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::BASE64) == 0);
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_r.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::RAW) == 0);
+
+  std::string b_str = slurp("utest_xml_vtk_binary_b.vtu");
+  BOOST_CHECK(b_str.find("format='binary'") != std::string::npos);
+  BOOST_CHECK(b_str.find("format='ascii'") == std::string::npos);
+
+  // First appended array is NORMALS: a UInt64 byte count followed by 5 points of 3 doubles
+  std::string r_str = slurp("utest_xml_vtk_binary_r.vtu");
+  std::string::size_type data_pos = r_str.find('_', r_str.find("<AppendedData encoding='raw'>"));
+  BOOST_REQUIRE(data_pos != std::string::npos);
+  std::uint64_t num_bytes;
+  std::memcpy(&num_bytes, r_str.data()+data_pos+1, sizeof(num_bytes));
+  BOOST_CHECK(num_bytes == 5*3*sizeof(double));
+  std::array<double, 15> normals;
+  std::memcpy(normals.data(), r_str.data()+data_pos+1+sizeof(num_bytes), sizeof(normals));
+  BOOST_CHECK(normals == (std::array<double, 15>({0.0, 0.0, 0.0,  1.0, 0.0, 0.0,  1.0, 1.0, 0.0,  0.0, 1.0, 0.0,  2.0, 0.5, 0.0})));
+  BOOST_CHECK(r_str.find("offset='" + std::to_string(sizeof(num_bytes)+num_bytes) + "'") != std::string::npos);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+#if FUNCVIZ_FOUND_ZLIB
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_bz.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::BASE64_ZLIB, 9, 2) == 0);
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_rz.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::RAW_ZLIB,    9, 2) == 0);
+
+  // NORMALS fits in one block: [number of blocks, block size, last block size, compressed size] followed by the compressed data
+  std::string rz_str = slurp("utest_xml_vtk_binary_rz.vtu");
+  BOOST_CHECK(rz_str.find("compressor='vtkZLibDataCompressor'") != std::string::npos);
+  data_pos = rz_str.find('_', rz_str.find("<AppendedData encoding='raw'>"));
+  BOOST_REQUIRE(data_pos != std::string::npos);
+  std::array<std::uint64_t, 4> zlib_header;
+  std::memcpy(zlib_header.data(), rz_str.data()+data_pos+1, sizeof(zlib_header));
+  BOOST_CHECK(zlib_header[0] == 1);
+  BOOST_CHECK(zlib_header[1] == cc_t::xml_zlib_block_size);
+  BOOST_CHECK(zlib_header[2] == 5*3*sizeof(double));
+  std::array<double, 15> zlib_normals;
+  uLongf dest_len = sizeof(zlib_normals);
+  BOOST_CHECK(uncompress(reinterpret_cast<Bytef*>(zlib_normals.data()), &dest_len,
+                         reinterpret_cast<const Bytef*>(rz_str.data()+data_pos+1+sizeof(zlib_header)), static_cast<uLong>(zlib_header[3])) == Z_OK);
+  BOOST_CHECK(dest_len == sizeof(zlib_normals));
+  BOOST_CHECK(zlib_normals == normals);
+
+  // A bad compression level makes compression fail, and no file is left behind
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_bad.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::RAW_ZLIB, 42) == 4);
+  BOOST_CHECK( !(std::ifstream("utest_xml_vtk_binary_bad.vtu").good()));
+#else
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_xml_vtk_binary_rz.vtu", "xml_vtk_binary", cc_t::xml_encoding_t::RAW_ZLIB) == 4);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(ascii_format) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  auto slurp = [](std::string file_name) { std::ifstream in_stream(file_name, std::ios::binary); std::stringstream ss; ss << in_stream.rdbuf(); return ss.str(); };
+  auto real  = [](double v, int precision) { std::string buf; cc_t::append_real(buf, v, precision); return buf; };
+  auto strm  = [](double v, int precision) { std::ostringstream ss; ss << std::setprecision(precision) << v; return ss.str(); };
+
+  // Same text as a stream with std::setprecision(), or round trip text for precision zero
+  for(double v: {0.0, -0.0, 1.0, 1.0/3.0, -2.5e-17, 6.02214076e23, 123456789012.0, 1.0e-5, std::numeric_limits<double>::infinity()})
+    for(int precision: {1, 6, 10, 17})
+      BOOST_CHECK(real(v, precision) == strm(v, precision));
+  BOOST_CHECK(real(1.0/3.0, 0) == "0.3333333333333333");
+  BOOST_CHECK(std::stod(real(0.1+0.2, 0)) == 0.1+0.2);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  cc_t aPoly;
+
+  for(int i=0; i<50; i++)
+    for(int j=0; j<50; j++)
+      aPoly.add_node(cc_t::node_data_t({i/7.0, j/3.0, std::sin(i*j/10.0)}));
+  for(int i=0; i<49; i++)
+    for(int j=0; j<49; j++)
+      aPoly.add_cell(cc_t::cell_kind_t::QUAD, {i*50+j, i*50+j+1, (i+1)*50+j+1, (i+1)*50+j});
+  aPoly.create_named_datasets({"x", "y", "z"}, {{"NORMALS", {0, 1, 2}}});
+
+  // Output does not depend on the number of threads
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_ascii_format_1.vtu", "ascii_format", cc_t::xml_encoding_t::ASCII, -1, 1) == 0);
+  BOOST_CHECK(aPoly.write_xml_vtk("utest_ascii_format_4.vtu", "ascii_format", cc_t::xml_encoding_t::ASCII, -1, 4) == 0);
+  BOOST_CHECK(slurp("utest_ascii_format_1.vtu") == slurp("utest_ascii_format_4.vtu"));
+  BOOST_CHECK(aPoly.write_ply("utest_ascii_format_1.ply", "ascii_format", cc_t::ply_encoding_t::ASCII, 1) == 0);
+  BOOST_CHECK(aPoly.write_ply("utest_ascii_format_4.ply", "ascii_format", cc_t::ply_encoding_t::ASCII, 4) == 0);
+  BOOST_CHECK(slurp("utest_ascii_format_1.ply") == slurp("utest_ascii_format_4.ply"));
+
+  // Round trip output
+  BOOST_CHECK(aPoly.get_ascii_precision() == 10);
+  aPoly.set_ascii_precision(0);
+  BOOST_CHECK(aPoly.write_legacy_vtk("utest_ascii_format_0.vtk", "ascii_format") == 0);
+  BOOST_CHECK(slurp("utest_ascii_format_0.vtk").find(real(1.0/7.0, 0) + " ") != std::string::npos);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(ply_binary) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  auto slurp = [](std::string file_name) { std::ifstream in_stream(file_name, std::ios::binary); std::stringstream ss; ss << in_stream.rdbuf(); return ss.str(); };
+
+  cc_t aPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {2.0, 0.5, 0.0}}));
+  aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3}));
+  aPoly.add_cell(cc_t::cell_kind_t::QUAD, {1, 4, 2, 3});
+  aPoly.create_named_datasets({"x", "y", "z"}, {{"COLORS", {0, 1, 2}}});
+
+  BOOST_CHECK(aPoly.write_ply("utest_ply_binary_32.ply", "ply_binary", cc_t::ply_encoding_t::BINARY_FLOAT32) == 0);
+  BOOST_CHECK(aPoly.write_ply("utest_ply_binary_64.ply", "ply_binary", cc_t::ply_encoding_t::BINARY_FLOAT64, 2) == 0);
+
+  for(int real_size: {4, 8}) {
+    std::string ply_str = slurp("utest_ply_binary_" + std::to_string(8*real_size) + ".ply");
+    std::string::size_type data_pos = ply_str.find("end_header\n");
+    BOOST_REQUIRE(data_pos != std::string::npos);
+    BOOST_CHECK(ply_str.find(real_size == 8 ? "property double x" : "property float x") != std::string::npos);
+    data_pos += 11;
+    // Vertexes are 3 reals & 3 uchar colors.  Faces are a uchar count followed by int32 vertex indexes.
+    BOOST_CHECK(ply_str.size() == data_pos + 5*(3*real_size+3) + 2*(1+3*4) + (1+4*4));
+    const char* vert_2 = ply_str.data() + data_pos + 2*(3*real_size+3);
+    if (real_size == 8) {
+      std::array<double, 3> pnt;
+      std::memcpy(pnt.data(), vert_2, sizeof(pnt));
+      BOOST_CHECK(pnt == (std::array<double, 3>({1.0, 1.0, 0.0})));
+    } else {
+      std::array<float, 3> pnt;
+      std::memcpy(pnt.data(), vert_2, sizeof(pnt));
+      BOOST_CHECK(pnt == (std::array<float, 3>({1.0f, 1.0f, 0.0f})));
+    }
+    BOOST_CHECK(static_cast<unsigned char>(vert_2[3*real_size+0]) == 255);
+    BOOST_CHECK(static_cast<unsigned char>(vert_2[3*real_size+1]) == 255);
+    BOOST_CHECK(static_cast<unsigned char>(vert_2[3*real_size+2]) == 0);
+    const char* face_2 = ply_str.data() + data_pos + 5*(3*real_size+3) + 2*(1+3*4);
+    std::array<std::int32_t, 4> quad;
+    std::memcpy(quad.data(), face_2+1, sizeof(quad));
+    BOOST_CHECK(face_2[0] == 4);
+    BOOST_CHECK(quad == (std::array<std::int32_t, 4>({1, 4, 2, 3})));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(legacy_vtk_binary) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  auto slurp = [](std::string file_name) { std::ifstream in_stream(file_name, std::ios::binary); std::stringstream ss; ss << in_stream.rdbuf(); return ss.str(); };
+  auto be_int32 = [](const char* p) { std::int32_t v = 0; for(int i=0; i<4; i++) v = (v << 8) | static_cast<unsigned char>(p[i]); return v; };
+  auto be_real  = [](const char* p) { std::uint64_t v = 0; for(int i=0; i<8; i++) v = (v << 8) | static_cast<unsigned char>(p[i]); return std::bit_cast<double>(v); };
+
+  cc_t aPoly;
+
+  aPoly.add_nodes(std::vector<cc_t::node_data_t>({{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {2.0, 0.5, 0.0}}));
+  aPoly.add_cells(cc_t::cell_kind_t::TRIANGLE, cc_t::node_idx_list_t({0, 1, 2,  0, 2, 3}));
+  aPoly.add_cell(cc_t::cell_kind_t::QUAD, {1, 4, 2, 3});
+  aPoly.create_named_datasets({"x", "y", "z"}, {{"NORMALS", {0, 1, 2}}});
+  aPoly.set_node_data_value(3, 1, std::numeric_limits<double>::quiet_NaN());
+
+  BOOST_CHECK(aPoly.write_legacy_vtk("utest_legacy_vtk_binary.vtk", "legacy_vtk_binary", cc_t::legacy_encoding_t::BINARY, 2) == 0);
+  std::string vtk_str = slurp("utest_legacy_vtk_binary.vtk");
+  BOOST_CHECK(vtk_str.find("\nBINARY\n") != std::string::npos);
+
+  // Points are big endian doubles
+  std::string::size_type pnts_pos = vtk_str.find("POINTS 5 double\n");
+  BOOST_REQUIRE(pnts_pos != std::string::npos);
+  const char* pnts = vtk_str.data() + pnts_pos + 16;
+  BOOST_CHECK(be_real(pnts+8*(3*4+0)) == 2.0);
+  BOOST_CHECK(be_real(pnts+8*(3*4+1)) == 0.5);
+
+  // Cells are big endian int32s: vertex count followed by vertexes
+  std::string::size_type cells_pos = vtk_str.find("CELLS 3 13\n");
+  BOOST_REQUIRE(cells_pos != std::string::npos);
+  const char* cells = vtk_str.data() + cells_pos + 11;
+  BOOST_CHECK(be_int32(cells+4*8)  == 4);
+  BOOST_CHECK(be_int32(cells+4*10) == 4);
+  std::string::size_type kinds_pos = vtk_str.find("CELL_TYPES 3\n");
+  BOOST_REQUIRE(kinds_pos != std::string::npos);
+  BOOST_CHECK(be_int32(vtk_str.data()+kinds_pos+13+4*2) == static_cast<std::int32_t>(cc_t::cell_kind_t::QUAD));
+
+  // NaN survives
+  std::string::size_type y_pos = vtk_str.find("SCALARS y double 1\nLOOKUP_TABLE default\n");
+  BOOST_REQUIRE(y_pos != std::string::npos);
+  BOOST_CHECK(std::isnan(be_real(vtk_str.data()+y_pos+40+8*3)));
+  BOOST_CHECK(be_real(vtk_str.data()+y_pos+40+8*2) == 1.0);
+}
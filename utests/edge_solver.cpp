@@ -0,0 +1,210 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      edge_solver.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @brief     Unit tests for MR_cell_cplx.@EOL
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Main
+#include <boost/test/unit_test.hpp>
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "MR_cell_cplx.hpp"
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(edge_solver_cache) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  int num_sdf_evals = 0;
+  cc_t::p2real_func_t sdf_func  = [&num_sdf_evals](const cc_t::node_data_t& nd) { num_sdf_evals++; return nd[0]-0.3; };
+  cc_t::p2data_func_t data_func = [](const cc_t::node_data_t& nd) { return nd; };
+
+  cc_t aPoly;
+
+  aPoly.add_node({0.0, 0.0, 0.0}); // 0
+  aPoly.add_node({1.0, 0.0, 0.0}); // 1
+  aPoly.add_node({1.0, 1.0, 0.0}); // 2
+  aPoly.add_node({0.0, 1.0, 0.0}); // 3
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Solutions are cached per edge, in either direction
+
+  cc_t::node_idx_t sol_idx = aPoly.edge_solver_sdf(data_func, 0, 1, sdf_func);
+  BOOST_CHECK(sol_idx == 4);
+  BOOST_CHECK_CLOSE(aPoly.get_pnt(sol_idx)[0], 0.3, 1.0e-3);
+
+  num_sdf_evals = 0;
+  BOOST_CHECK(aPoly.edge_solver_sdf(data_func, 1, 0, sdf_func) == sol_idx);
+  BOOST_CHECK(num_sdf_evals == 0);
+
+  aPoly.clear_cache_edge_solver_sdf();
+  BOOST_CHECK(aPoly.edge_solver_sdf(data_func, 1, 0, sdf_func) == sol_idx);  // Same point found by add_node()
+  BOOST_CHECK(num_sdf_evals > 0);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Shared edges are solved once, and the cache may be kept between folds
+
+  aPoly.clear();
+  aPoly.add_node({0.0, 0.0, 0.0}); // 0
+  aPoly.add_node({1.0, 0.0, 0.0}); // 1
+  aPoly.add_node({1.0, 1.0, 0.0}); // 2
+  aPoly.add_node({0.0, 1.0, 0.0}); // 3
+  aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 1, 2});
+  aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, {0, 2, 3});
+  aPoly.add_cell(cc_t::cell_kind_t::SEGMENT,  {0, 2});
+
+  aPoly.triangle_folder(data_func, sdf_func);
+  BOOST_CHECK(aPoly.node_count() == 7);   // One new node on each of the three crossing edges
+  BOOST_CHECK(aPoly.num_cells()  == 7);
+
+  num_sdf_evals = 0;
+  aPoly.segment_folder(data_func, sdf_func, cc_t::epsilon/10, false);
+  BOOST_CHECK(aPoly.node_count() == 7);   // Edge {0, 2} was solved by triangle_folder()
+  BOOST_CHECK(aPoly.num_cells()  == 8);
+  BOOST_CHECK(num_sdf_evals == 2);        // Only the vertex classification of the one segment
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(edge_solver_methods) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t::p2data_func_t data_func = [](const cc_t::node_data_t& nd) { return nd; };
+
+  std::vector<cc_t::p2real_func_t> sdf_funcs = { [](const cc_t::node_data_t& nd) { return nd[0]-0.3; },
+                                                 [](const cc_t::node_data_t& nd) { return nd[0]*nd[0]*nd[0]-0.2; },
+                                                 [](const cc_t::node_data_t& nd) { return std::exp(8*nd[0])-2; },
+                                                 [](const cc_t::node_data_t& nd) { return std::sqrt(nd[0]*nd[0]+nd[1]*nd[1])-0.7; } };
+
+  std::vector<cc_t::edge_solver_t> solvers = { cc_t::edge_solver_t::BISECTION, cc_t::edge_solver_t::ILLINOIS, cc_t::edge_solver_t::BRENT, cc_t::edge_solver_t::ITP };
+
+  for(const auto& sdf_func: sdf_funcs) {
+    std::size_t bisection_evals = 0;
+    for(auto solver: solvers) {
+      cc_t aPoly;
+      aPoly.set_edge_solver(solver);
+      BOOST_CHECK(aPoly.get_edge_solver() == solver);
+      aPoly.add_node({1.0, 0.9, 0.0});
+      aPoly.add_node({0.0, 0.1, 0.0});
+      cc_t::node_idx_t sol_idx = aPoly.edge_solver_sdf(data_func, 0, 1, sdf_func);
+      BOOST_CHECK(sol_idx == 2);
+      BOOST_CHECK(std::abs(sdf_func(aPoly.get_node_data(sol_idx))) <= cc_t::epsilon/10);
+      BOOST_CHECK(aPoly.get_pnt(sol_idx)[0] > 0.0);                                                // Solution is inside the bracket
+      BOOST_CHECK(aPoly.get_pnt(sol_idx)[0] < 1.0);
+      BOOST_CHECK_CLOSE(aPoly.get_pnt(sol_idx)[1], 0.1+0.8*aPoly.get_pnt(sol_idx)[0], 1.0e-6); // Solution is on the edge
+      BOOST_CHECK(aPoly.edge_solver_sdf_solve_count() == 1);
+      if (solver == cc_t::edge_solver_t::BISECTION)
+        bisection_evals = aPoly.edge_solver_sdf_eval_count();
+      else
+        BOOST_CHECK(aPoly.edge_solver_sdf_eval_count() < bisection_evals);
+      aPoly.clear_edge_solver_sdf_counts();
+      BOOST_CHECK(aPoly.edge_solver_sdf_eval_count() == 0);
+      BOOST_CHECK(aPoly.edge_solver_sdf_solve_count() == 0);
+    }
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // A discontinuous SDF still terminates with a point between the edge vertexes
+
+  for(auto solver: solvers) {
+    cc_t aPoly;
+    aPoly.set_edge_solver(solver);
+    aPoly.add_node({0.0, 0.0, 0.0});
+    aPoly.add_node({1.0, 0.0, 0.0});
+    cc_t::node_idx_t sol_idx = aPoly.edge_solver_sdf(data_func, 0, 1, [](const cc_t::node_data_t& nd) { return (nd[0] < 0.4123 ? -1.0 : 1.0); });
+    BOOST_CHECK_CLOSE(aPoly.get_pnt(sol_idx)[0], 0.4123, 1.0e-6);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(triangle_folder_threads) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t::p2real_func_t sdf_func  = [](const cc_t::node_data_t& nd) { return nd[0]*nd[0]+nd[1]*nd[1]-0.5; };
+  cc_t::p2data_func_t data_func = [](const cc_t::node_data_t& nd) { return cc_t::node_data_t({nd[0], nd[1], nd[0]*nd[0]+nd[1]*nd[1]}); };
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Same complex for any number of threads
+
+  std::vector<cc_t> cplxs(3);
+  std::vector<int>  thread_counts = {1, 4, 0};
+  for(std::size_t k=0; k<cplxs.size(); k++) {
+    const int n = 20;
+    for(int i=0; i<=n; i++)
+      for(int j=0; j<=n; j++)
+        cplxs[k].add_node(data_func({-1.0+2.0*i/n, -1.0+2.0*j/n, 0.0}));
+    for(int i=0; i<n; i++)
+      for(int j=0; j<n; j++) {
+        cplxs[k].add_cell(cc_t::cell_kind_t::TRIANGLE, {i*(n+1)+j, (i+1)*(n+1)+j,   (i+1)*(n+1)+j+1});
+        cplxs[k].add_cell(cc_t::cell_kind_t::TRIANGLE, {i*(n+1)+j, (i+1)*(n+1)+j+1, i*(n+1)+j+1});
+      }
+    cplxs[k].triangle_folder(data_func, sdf_func, cc_t::epsilon/10, true, thread_counts[k]);
+  }
+
+  BOOST_CHECK(cplxs[0].num_cells() > 800);
+  for(std::size_t k=1; k<cplxs.size(); k++) {
+    BOOST_CHECK(cplxs[k].node_count() == cplxs[0].node_count());
+    BOOST_CHECK(cplxs[k].num_cells()  == cplxs[0].num_cells());
+    BOOST_CHECK(cplxs[k].edge_solver_sdf_eval_count()  == cplxs[0].edge_solver_sdf_eval_count());
+    BOOST_CHECK(cplxs[k].edge_solver_sdf_solve_count() == cplxs[0].edge_solver_sdf_solve_count());
+    for(cc_t::node_idx_t i=0; i<cplxs[0].node_count(); i++)
+      BOOST_CHECK(cplxs[k].get_node_data(i) == cplxs[0].get_node_data(i));
+    for(int i=0; i<cplxs[0].num_cells(); i++)
+      BOOST_CHECK(std::ranges::equal(cplxs[k].get_cell_verts(i), cplxs[0].get_cell_verts(i)));
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Triangles with one vertex on the boundary are split in two -- whichever vertex it is.
+
+  for(int zero_loc=0; zero_loc<3; zero_loc++) {
+    cc_t aPoly;
+    std::array<cc_t::node_data_t, 3> pts = {{ {0.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0} }};  // SDF is zero on pts[0]
+    cc_t::cell_verts_t tri(3);
+    for(int i=0; i<3; i++)
+      tri[static_cast<std::size_t>((i+zero_loc)%3)] = aPoly.add_node(pts[static_cast<std::size_t>(i)]);
+    aPoly.add_cell(cc_t::cell_kind_t::TRIANGLE, tri);
+    aPoly.triangle_folder([](const cc_t::node_data_t& nd) { return nd; }, [](const cc_t::node_data_t& nd) { return nd[0]-nd[1]; });
+    BOOST_CHECK(aPoly.node_count() == 4);
+    BOOST_CHECK(aPoly.num_cells()  == 2);
+    for(int i=0; i<aPoly.num_cells(); i++) {
+      cc_t::cell_verts_t c(aPoly.get_cell_verts(i).begin(), aPoly.get_cell_verts(i).end());
+      std::sort(c.begin(), c.end());
+      BOOST_CHECK(std::ranges::count(c, 3) == 1);    // Each half has the new vertex
+      BOOST_CHECK(c[0] == 0);                        // Each half has the zero vertex
+    }
+  }
+}
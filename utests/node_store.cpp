@@ -0,0 +1,131 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      node_store.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @brief     Unit tests for MR_cell_cplx.@EOL
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Main
+#include <boost/test/unit_test.hpp>
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "MR_cell_cplx.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(node_store) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5, mjr::MR_cc_node_store_t::VECTORS> ccv_t;
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5, mjr::MR_cc_node_store_t::FLAT>    ccf_t;
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5, mjr::MR_cc_node_store_t::COLUMNS> ccc_t;
+
+  ccv_t aPolyV;
+  ccf_t aPolyF;
+  ccc_t aPolyC;
+
+  aPolyV.create_dataset_to_point_mapping({1, 2, 3});
+  aPolyF.create_dataset_to_point_mapping({1, 2, 3});
+  aPolyC.create_dataset_to_point_mapping({1, 2, 3});
+
+  for(int i=0; i<4; i++) {
+    double x = i;
+    BOOST_CHECK(aPolyV.add_node({10*x, x, x*x, 1.0}) == i);
+    BOOST_CHECK(aPolyF.add_node({10*x, x, x*x, 1.0}) == i);
+    BOOST_CHECK(aPolyC.add_node({10*x, x, x*x, 1.0}) == i);
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  BOOST_CHECK(aPolyV.node_count() == 4);
+  BOOST_CHECK(aPolyF.node_count() == 4);
+  BOOST_CHECK(aPolyC.node_count() == 4);
+
+  BOOST_CHECK(aPolyF.node_data_size(2) == 4);
+  BOOST_CHECK(aPolyC.node_data_size(2) == 4);
+
+  BOOST_CHECK(aPolyV.get_pnt(3) == aPolyF.get_pnt(3));
+  BOOST_CHECK(aPolyV.get_pnt(3) == aPolyC.get_pnt(3));
+
+  BOOST_CHECK(aPolyV.get_node_data(2) == aPolyF.get_node_data(2));
+  BOOST_CHECK(aPolyV.get_node_data(2) == aPolyC.get_node_data(2));
+
+  BOOST_TEST_CHECK(aPolyF.get_node_data_value(3, 0) == 30.0, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyC.get_node_data_value(3, 0) == 30.0, boost::test_tools::tolerance(0.00001));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  BOOST_CHECK(aPolyF.add_node({1.0, 1.0, 1.0, 1.0}) == 1);             // Duplicate point
+  BOOST_CHECK(aPolyC.add_node({1.0, 1.0, 1.0, 1.0}) == 1);             // Duplicate point
+
+  BOOST_CHECK(aPolyF.add_node({1.0, 5.0, 5.0, 5.0, 1.0}) == -1);       // Wrong width
+  BOOST_CHECK(aPolyC.add_node({1.0, 5.0, 5.0, 5.0, 1.0}) == -1);       // Wrong width
+  BOOST_CHECK(aPolyV.add_node({1.0, 5.0, 5.0, 5.0, 1.0}) ==  4);       // VECTORS allows any width
+
+  BOOST_CHECK(aPolyF.node_count() == 4);
+  BOOST_CHECK(aPolyC.node_count() == 4);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  aPolyF.set_node_data_value(2, 3, 7.0);
+  aPolyC.set_node_data_value(2, 3, 7.0);
+
+  BOOST_TEST_CHECK(aPolyF.get_pnt(2)[2] == 7.0, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyC.get_pnt(2)[2] == 7.0, boost::test_tools::tolerance(0.00001));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  aPolyV.create_dataset_to_point_mapping({0, 3, 0.5});                 // Cached points follow a new mapping
+  aPolyF.create_dataset_to_point_mapping({0, 3, 0.5});
+
+  BOOST_TEST_CHECK(aPolyV.get_pnt(3)[0] == 30.0, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyV.get_pnt(3)[1] ==  1.0, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyV.get_pnt(3)[2] ==  0.5, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyF.get_pnt(2)[1] ==  7.0, boost::test_tools::tolerance(0.00001));
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::array<double, 4> nd_arr = {0.0, 9.0, 9.0, 9.0};                 // std::span overload
+  BOOST_CHECK(aPolyF.add_node(std::span<const double>(nd_arr)) == 4);
+  BOOST_CHECK(aPolyF.get_node_data(4) == ccf_t::node_data_t({0.0, 9.0, 9.0, 9.0}));
+
+  ccv_t::node_data_t nd_vec = {0.0, 8.0, 8.0, 8.0};                    // rvalue overload
+  BOOST_CHECK(aPolyV.add_node(std::move(nd_vec)) == 5);
+  BOOST_CHECK(aPolyV.get_node_data(5) == ccv_t::node_data_t({0.0, 8.0, 8.0, 8.0}));
+
+  BOOST_TEST_CHECK(aPolyV.scalar_from_node_data(2.5, nd_arr) == 2.5, boost::test_tools::tolerance(0.00001));
+  BOOST_TEST_CHECK(aPolyV.scalar_from_node_data(1,   nd_arr) == 9.0, boost::test_tools::tolerance(0.00001));
+
+  aPolyF.clear();
+  BOOST_CHECK(aPolyF.node_count() == 0);
+  BOOST_CHECK(aPolyF.add_node({1.0, 2.0, 3.0}) == 0);                  // Width reset by clear()
+}
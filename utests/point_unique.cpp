@@ -0,0 +1,115 @@
+// -*- Mode:C++; Coding:us-ascii-unix; fill-column:158 -*-
+/*******************************************************************************************************************************************************.H.S.**/
+/**
+ @file      point_unique.cpp
+ @author    Mitch Richling http://www.mitchr.me/
+ @date      2026-10-16
+ @brief     Unit tests for MR_cell_cplx.@EOL
+ @std       C++23
+ @copyright 
+  @parblock
+  Copyright (c) 2024, Mitchell Jay Richling <http://www.mitchr.me/> All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice, this list of conditions, and the following disclaimer.
+
+  2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions, and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software
+     without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+  OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+  DAMAGE.
+  @endparblock
+*/
+/*******************************************************************************************************************************************************.H.E.**/
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Main
+#include <boost/test/unit_test.hpp>
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "MR_cell_cplx.hpp"
+
+
+#include <limits>
+#include <random>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(point_unique) {
+
+  typedef mjr::MR_cell_cplx<true, true, true, true, true, double, 1.0e-5> cc_t;
+
+  cc_t aPoly;
+
+  std::mt19937 rEng(42);
+  std::uniform_real_distribution<double> uDist(-1.0, 1.0);
+  std::uniform_real_distribution<double> pDist(-0.4e-5, 0.4e-5);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Random points -- all distinct
+
+  std::vector<cc_t::fvec3_t> pnts;
+  for(int i=0; i<2000; i++) {
+    cc_t::fvec3_t p = {uDist(rEng), uDist(rEng), uDist(rEng)};
+    pnts.push_back(p);
+    BOOST_CHECK(aPoly.add_node({p[0], p[1], p[2]}) == i);
+  }
+  BOOST_CHECK(aPoly.node_count() == 2000);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Perturbed copies must find the original point
+
+  int num_found = 0;
+  for(int i=0; i<2000; i++)
+    if (aPoly.add_node({pnts[i][0]+pDist(rEng), pnts[i][1]+pDist(rEng), pnts[i][2]+pDist(rEng)}) == i)
+      num_found++;
+  BOOST_CHECK(num_found == 2000);
+  BOOST_CHECK(aPoly.node_count() == 2000);
+  BOOST_CHECK(aPoly.last_point_added_was_new() == false);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Points near bucket boundaries (multiples of 2*eps)
+
+  BOOST_CHECK(aPoly.add_node({2.0e-5-1.0e-7, 5.0, 5.0}) == 2000);
+  BOOST_CHECK(aPoly.add_node({2.0e-5+1.0e-7, 5.0, 5.0}) == 2000);
+  BOOST_CHECK(aPoly.add_node({2.0e-5+5.0e-6, 5.0, 5.0}) == 2000);
+  BOOST_CHECK(aPoly.add_node({2.0e-5-1.0e-7, 5.0-1.0e-7, 5.0+1.0e-7}) == 2000);
+  BOOST_CHECK(aPoly.node_count() == 2001);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Points more than eps away are distinct
+
+  BOOST_CHECK(aPoly.add_node({2.0e-5+1.2e-5, 5.0, 5.0}) == 2001);
+  BOOST_CHECK(aPoly.add_node({2.0e-5, 5.0+1.1e-5, 5.0}) == 2002);
+  BOOST_CHECK(aPoly.add_node({2.0e-5, 5.0, 5.0-1.1e-5}) == 2003);
+  BOOST_CHECK(aPoly.last_point_added_was_new() == true);
+  BOOST_CHECK(aPoly.node_count() == 2004);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // Huge & infinite coordinates
+
+  BOOST_CHECK(aPoly.add_node({1.0e300, 0.0, 0.0}) == 2004);
+  BOOST_CHECK(aPoly.add_node({1.0e300, 0.0, 0.0}) == 2004);
+  BOOST_CHECK(aPoly.add_node({std::numeric_limits<double>::infinity(), 0.0, 0.0}) == 2005);
+  BOOST_CHECK(aPoly.add_node({std::numeric_limits<double>::infinity(), 0.0, 0.0}) == 2005);
+  BOOST_CHECK(aPoly.node_count() == 2006);
+
+  //--------------------------------------------------------------------------------------------------------------------------------------------------------------
+  // clear() empties the index
+
+  aPoly.clear();
+  BOOST_CHECK(aPoly.add_node({pnts[7][0], pnts[7][1], pnts[7][2]}) == 0);
+  BOOST_CHECK(aPoly.add_node({pnts[3][0], pnts[3][1], pnts[3][2]}) == 1);
+}